@@ -0,0 +1,130 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "raylib.h"
+#include "rlgl.h"
+#include "dlrl.h"
+
+#define DRAW_QUADS 500
+
+static void usage(const char* argv0) {
+    fprintf(stderr,
+        "usage: %s [asset] [options]\n"
+        "  -n <iterations>  timed iterations per case (default 2000)\n",
+        argv0);
+}
+
+static double ns(double seconds, int count) { return count > 0 ? seconds * 1e9 / count : 0.0; }
+
+/* Update cost must not grow with the step: a one-frame step and a week-long jump cost the same. */
+static void bench_stepping(dlrl_Player* p, int iterations) {
+    static const struct { const char* label; float dt; float speed; double fixed; } cases[] = {
+        { "1/60 s",                 1.0f / 60.0f, 1.0f,    0.0 },
+        { "10 s",                   10.0f,        1.0f,    0.0 },
+        { "1 h",                    3600.0f,      1.0f,    0.0 },
+        { "1 week",                 604800.0f,    1.0f,    0.0 },
+        { "1 week, speed 1000",     604800.0f,    1000.0f, 0.0 },
+        { "1 week, fixed 1/120 s",  604800.0f,    1.0f,    1.0 / 120.0 },
+    };
+    static const dlrl_Mode modes[] = { DLRL_MODE_FORWARD, DLRL_MODE_BOUNCE };
+
+    printf("stepping: dlrl_Update by delta (ns/update, loops reported by the last step)\n");
+    for (size_t m = 0; m < sizeof(modes) / sizeof(modes[0]); ++m) {
+        for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); ++c) {
+            dlrl_SetMode(p, modes[m]);
+            dlrl_SetSpeed(p, cases[c].speed);
+            dlrl_SetFixedStep(p, cases[c].fixed);
+            dlrl_Update(p, cases[c].dt);
+            double t0 = GetTime();
+            for (int i = 0; i < iterations; ++i) dlrl_Update(p, cases[c].dt);
+            double elapsed = GetTime() - t0;
+            dlrl_StepInfo last = dlrl_LastStep(p);
+            printf("  %-7s %-24s %10.0f ns   loops %d  steps %d\n",
+                   modes[m] == DLRL_MODE_FORWARD ? "forward" : "bounce", cases[c].label,
+                   ns(elapsed, iterations), last.loops, last.steps);
+        }
+    }
+    dlrl_SetMode(p, DLRL_MODE_FORWARD);
+    dlrl_SetSpeed(p, 1.0f);
+    dlrl_SetFixedStep(p, 0.0);
+}
+
+/* One player at DRAW_QUADS transforms: a dlrl_Draw per quad against one dlrl_DrawMany. */
+static void bench_draw(dlrl_Player* p, int iterations) {
+    static Rectangle dests[DRAW_QUADS];
+    static float rotations[DRAW_QUADS];
+    static Color tints[DRAW_QUADS];
+    for (int i = 0; i < DRAW_QUADS; ++i) {
+        dests[i] = (Rectangle){ (float)(i % 25) * 25.0f, (float)(i / 25) * 24.0f, 24.0f, 24.0f };
+        rotations[i] = (float)(i % 8) * 45.0f;
+        tints[i] = (Color){ 255, (unsigned char)(i * 7), (unsigned char)(i * 13), 255 };
+    }
+    int frames = iterations / 10 > 10 ? iterations / 10 : 10;
+    double loopTime = 0.0, manyTime = 0.0;
+    for (int f = 0; f < frames; ++f) {
+        BeginDrawing();
+        ClearBackground(BLACK);
+        double t0 = GetTime();
+        for (int i = 0; i < DRAW_QUADS; ++i) dlrl_Draw(p, dests[i], rotations[i], tints[i]);
+        /* Flushing inside the timed region counts the GPU submit too. */
+        rlDrawRenderBatchActive();
+        double t1 = GetTime();
+        dlrl_DrawMany(p, dests, rotations, tints, DRAW_QUADS);
+        rlDrawRenderBatchActive();
+        double t2 = GetTime();
+        EndDrawing();
+        loopTime += t1 - t0;
+        manyTime += t2 - t1;
+    }
+    printf("draw: %d quads of one player, %d frames (us/frame, submit + batch flush)\n", DRAW_QUADS, frames);
+    printf("  dlrl_Draw loop   %10.1f us\n", loopTime * 1e6 / frames);
+    printf("  dlrl_DrawMany    %10.1f us   (%.2fx)\n", manyTime * 1e6 / frames,
+           manyTime > 0.0 ? loopTime / manyTime : 0.0);
+}
+
+int main(int argc, char** argv) {
+    const char* asset = "super-man.lottie";
+    int iterations = 2000;
+
+    int argi = 1;
+    if (argi < argc && argv[argi][0] != '-') asset = argv[argi++];
+    for (; argi < argc; argi += 2) {
+        const char* opt = argv[argi];
+        const char* val = (argi + 1 < argc) ? argv[argi + 1] : NULL;
+        if (!val) { usage(argv[0]); return 2; }
+        if (strcmp(opt, "-n") == 0) iterations = atoi(val);
+        else { usage(argv[0]); return 2; }
+    }
+    if (iterations < 1) iterations = 1;
+
+    SetTraceLogLevel(LOG_WARNING);
+    SetConfigFlags(FLAG_WINDOW_HIDDEN);
+    InitWindow(640, 480, "dlrl bench");
+    dlrl_Init();
+
+    dlrl_Config cfg = {
+        .width = 128, .height = 128,
+        .speed = 1.0f, .loop = true,
+        .mode = DLRL_MODE_FORWARD,
+        .interpolate = true,
+        .fit = DLRL_FIT_CONTAIN,
+        .align = {0.5f, 0.5f},
+        .background = BLANK
+    };
+    dlrl_Player* p = dlrl_LoadDotLottieFile(asset, &cfg);
+    if (!p) {
+        fprintf(stderr, "bench: failed to load %s\n", asset);
+        CloseWindow();
+        return 1;
+    }
+    dlrl_Play(p);
+
+    bench_stepping(p, iterations);
+    bench_draw(p, iterations);
+
+    dlrl_Unload(p);
+    dlrl_Shutdown();
+    CloseWindow();
+    return 0;
+}
@@ -0,0 +1,120 @@
+// Times the dlrl.hpp wrappers against the same C calls on the same players. Every wrapper
+// member is an inline forward, so each pair should report the same cost.
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <span>
+#include <string_view>
+
+#include "dlrl.hpp"
+
+namespace {
+
+constexpr int kPlayers = 8;
+
+void usage(const char* argv0) {
+    std::fprintf(stderr,
+        "usage: %s [asset] [options]\n"
+        "  -n <iterations>  timed iterations per case (default 2000)\n",
+        argv0);
+}
+
+double ns(double seconds, long count) { return count > 0 ? seconds * 1e9 / static_cast<double>(count) : 0.0; }
+
+void report(const char* label, double cSeconds, double cppSeconds, long count) {
+    double c = ns(cSeconds, count), cpp = ns(cppSeconds, count);
+    std::printf("  %-22s C %10.1f ns   C++ %10.1f ns   (%+.1f%%)\n", label, c, cpp,
+                c > 0.0 ? (cpp - c) * 100.0 / c : 0.0);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const char* asset = "super-man.lottie";
+    int iterations = 2000;
+
+    int argi = 1;
+    if (argi < argc && argv[argi][0] != '-') asset = argv[argi++];
+    for (; argi < argc; argi += 2) {
+        const char* opt = argv[argi];
+        const char* val = (argi + 1 < argc) ? argv[argi + 1] : nullptr;
+        if (!val) { usage(argv[0]); return 2; }
+        if (std::strcmp(opt, "-n") == 0) iterations = std::atoi(val);
+        else { usage(argv[0]); return 2; }
+    }
+    if (iterations < 1) iterations = 1;
+
+    SetTraceLogLevel(LOG_WARNING);
+    SetConfigFlags(FLAG_WINDOW_HIDDEN);
+    InitWindow(640, 480, "dlrl bench (C++)");
+    dlrl_Init();
+
+    constexpr auto cfg = dlrl::Config{}.size(128, 128);
+    dlrl::Player players[kPlayers];
+    dlrl_Player* raw[kPlayers];
+    for (int i = 0; i < kPlayers; ++i) {
+        players[i] = dlrl::Player::load_file(asset, cfg);
+        if (!players[i]) {
+            std::fprintf(stderr, "bench_cpp: failed to load %s\n", asset);
+            CloseWindow();
+            return 1;
+        }
+        players[i].play();
+        raw[i] = players[i].get();
+    }
+
+    const char* first = dlrl_MarkerName(raw[0], 0);
+    std::string_view label = first ? std::string_view{first} : std::string_view{"missing"};
+    std::printf("C++ wrapper vs C API, %d players, %d iterations\n", kPlayers, iterations);
+
+    // Cheap calls expose wrapper overhead best; the sink keeps the loops from being elided.
+    volatile long sink = 0;
+    long calls = static_cast<long>(iterations) * 1000;
+    double t0 = GetTime();
+    for (long i = 0; i < calls; ++i) sink = sink + dlrl_FindMarkerN(raw[i % kPlayers], label.data(), label.size());
+    double t1 = GetTime();
+    for (long i = 0; i < calls; ++i) sink = sink + players[i % kPlayers].find_marker(label);
+    double t2 = GetTime();
+    report("find marker", t1 - t0, t2 - t1, calls);
+
+    t0 = GetTime();
+    for (long i = 0; i < calls; ++i) sink = sink + dlrl_IsPlaying(raw[i % kPlayers]);
+    t1 = GetTime();
+    for (long i = 0; i < calls; ++i) sink = sink + players[i % kPlayers].playing();
+    t2 = GetTime();
+    report("is playing", t1 - t0, t2 - t1, calls);
+
+    const float dt = 1.0f / 60.0f;
+    t0 = GetTime();
+    for (int i = 0; i < iterations; ++i) {
+        for (dlrl_Player* p : raw) dlrl_Update(p, dt);
+    }
+    t1 = GetTime();
+    for (int i = 0; i < iterations; ++i) dlrl::update(std::span{players}, dt);
+    t2 = GetTime();
+    report("update (all players)", t1 - t0, t2 - t1, iterations);
+
+    Rectangle dests[kPlayers];
+    for (int i = 0; i < kPlayers; ++i) dests[i] = Rectangle{ static_cast<float>(i) * 80.0f, 0.0f, 80.0f, 80.0f };
+    int frames = iterations / 10 > 10 ? iterations / 10 : 10;
+    double cTime = 0.0, cppTime = 0.0;
+    for (int f = 0; f < frames; ++f) {
+        BeginDrawing();
+        ClearBackground(BLACK);
+        t0 = GetTime();
+        for (int i = 0; i < kPlayers; ++i) dlrl_Draw(raw[i], dests[i], 0.0f, WHITE);
+        t1 = GetTime();
+        dlrl::draw(std::span{players}, std::span<const Rectangle>{dests});
+        t2 = GetTime();
+        EndDrawing();
+        cTime += t1 - t0;
+        cppTime += t2 - t1;
+    }
+    report("draw (all players)", cTime, cppTime, frames);
+    (void)sink;
+
+    for (dlrl::Player& p : players) p.reset();
+    dlrl_Shutdown();
+    CloseWindow();
+    return 0;
+}
@@ -0,0 +1,72 @@
+/* Compares the canvas blend kernel picked for this build (SSE2, NEON or scalar) against
+ * blend_row_scalar. It includes dlrl.c to reach the static kernels and never opens a window. */
+#include "dlrl.c"
+
+#include <stdio.h>
+
+#define CHECK_MAX_ROW 67
+
+static uint32_t rng_state = 0x9E3779B9u;
+
+static uint32_t next_random(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+/* Alpha edge cases (0, 1, 254, 255) show up often enough to be hit on every run. */
+static unsigned char random_channel(void)
+{
+    static const unsigned char edges[4] = { 0, 1, 254, 255 };
+    uint32_t r = next_random();
+    return (r & 3u) == 0 ? edges[(r >> 2) & 3u] : (unsigned char)(r >> 8);
+}
+
+static uint32_t random_pixel(void)
+{
+    return (uint32_t)random_channel() | ((uint32_t)random_channel() << 8) |
+           ((uint32_t)random_channel() << 16) | ((uint32_t)random_channel() << 24);
+}
+
+int main(int argc, char** argv)
+{
+    int rounds = (argc > 1) ? atoi(argv[1]) : 200000;
+    if (rounds < 1) rounds = 1;
+
+#if defined(DLRL_SIMD_SSE2)
+    const char* kernel = "sse2";
+#elif defined(DLRL_SIMD_NEON)
+    const char* kernel = "neon";
+#else
+    const char* kernel = "scalar";
+#endif
+
+    /* +1 so rows can start off a 16-byte boundary. */
+    uint32_t src[CHECK_MAX_ROW + 1], expect[CHECK_MAX_ROW + 1], got[CHECK_MAX_ROW + 1];
+    long mismatches = 0;
+    for (int r = 0; r < rounds; ++r) {
+        int n = (int)(next_random() % (CHECK_MAX_ROW + 1));
+        int offset = (int)(next_random() & 1u);
+        Color tint = { random_channel(), random_channel(), random_channel(), random_channel() };
+        for (int i = 0; i < n; ++i) {
+            src[offset + i] = random_pixel();
+            expect[offset + i] = got[offset + i] = random_pixel();
+        }
+        blend_row_scalar(expect + offset, src + offset, n, tint);
+        blend_row(got + offset, src + offset, n, tint);
+        for (int i = 0; i < n; ++i) {
+            if (expect[offset + i] == got[offset + i]) continue;
+            if (mismatches++ < 10) {
+                fprintf(stderr, "round %d pixel %d/%d src %08x tint %02x%02x%02x%02x: scalar %08x %s %08x\n",
+                        r, i, n, (unsigned)src[offset + i], tint.r, tint.g, tint.b, tint.a,
+                        (unsigned)expect[offset + i], kernel, (unsigned)got[offset + i]);
+            }
+        }
+    }
+
+    printf("%s kernel, %d rows: %ld mismatching pixels\n", kernel, rounds, mismatches);
+    printf("%s\n", mismatches == 0 ? "PASS" : "FAIL");
+    return mismatches == 0 ? 0 : 1;
+}
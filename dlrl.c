@@ -1,19 +1,280 @@
 #include "dlrl.h"
 #include "dotlottie_player.h"  
+#include "rlgl.h"               /* dlrl_DrawMany fills one render batch directly */
 #include <ctype.h>
+#include <math.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <errno.h>
+#include <unistd.h>
+#endif
+#if defined(_WIN32)
+#include <io.h>
+#endif
+#if !defined(_WIN32) && !defined(DLRL_NO_THREADS)
+#define DLRL_HAVE_PTHREADS 1
+#include <pthread.h>
+#endif
+#if !defined(DLRL_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define DLRL_SIMD_SSE2 1
+#include <emmintrin.h>
+#elif !defined(DLRL_NO_SIMD) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#define DLRL_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
+#if defined(DLRL_TRACK_ALLOCS)
+/* Soak builds route this file's allocations and textures through counters; see dlrl_GetAllocStats. */
+static struct {
+    size_t liveBytes, peakBytes, liveAllocations;
+    uint64_t totalAllocations;
+    int liveTextures;
+    size_t textureBytes;
+#if defined(DLRL_HAVE_PTHREADS)
+    pthread_mutex_t lock;
+#endif
+} g_track = {
+#if defined(DLRL_HAVE_PTHREADS)
+    .lock = PTHREAD_MUTEX_INITIALIZER
+#else
+    .liveBytes = 0
+#endif
+};
+
+#define DLRL_TRACK_HEADER 16u
+
+static void track_adjust(long long bytes, int allocations)
+{
+#if defined(DLRL_HAVE_PTHREADS)
+    pthread_mutex_lock(&g_track.lock);
+#endif
+    g_track.liveBytes = (size_t)((long long)g_track.liveBytes + bytes);
+    g_track.liveAllocations = (size_t)((long long)g_track.liveAllocations + allocations);
+    if (allocations > 0) g_track.totalAllocations++;
+    if (g_track.liveBytes > g_track.peakBytes) g_track.peakBytes = g_track.liveBytes;
+#if defined(DLRL_HAVE_PTHREADS)
+    pthread_mutex_unlock(&g_track.lock);
+#endif
+}
+
+static void* track_alloc(unsigned int size)
+{
+    unsigned char* block = (unsigned char*)MemAlloc(size + DLRL_TRACK_HEADER);
+    if (!block) return NULL;
+    memcpy(block, &size, sizeof(size));
+    track_adjust(size, 1);
+    return block + DLRL_TRACK_HEADER;
+}
+
+static void track_free(void* ptr)
+{
+    if (!ptr) return;
+    unsigned char* block = (unsigned char*)ptr - DLRL_TRACK_HEADER;
+    unsigned int size = 0;
+    memcpy(&size, block, sizeof(size));
+    track_adjust(-(long long)size, -1);
+    MemFree(block);
+}
+
+static void* track_realloc(void* ptr, unsigned int size)
+{
+    if (!ptr) return track_alloc(size);
+    unsigned char* block = (unsigned char*)ptr - DLRL_TRACK_HEADER;
+    unsigned int old = 0;
+    memcpy(&old, block, sizeof(old));
+    unsigned char* grown = (unsigned char*)MemRealloc(block, size + DLRL_TRACK_HEADER);
+    if (!grown) return NULL;
+    memcpy(grown, &size, sizeof(size));
+    track_adjust((long long)size - (long long)old, 0);
+    return grown + DLRL_TRACK_HEADER;
+}
+
+static Texture2D track_load_texture(Image img)
+{
+    Texture2D t = LoadTextureFromImage(img);
+    if (t.id != 0) {
+        g_track.liveTextures++;
+        g_track.textureBytes += (size_t)GetPixelDataSize(t.width, t.height, t.format);
+    }
+    return t;
+}
+
+static void track_unload_texture(Texture2D t)
+{
+    if (t.id != 0) {
+        g_track.liveTextures--;
+        g_track.textureBytes -= (size_t)GetPixelDataSize(t.width, t.height, t.format);
+    }
+    UnloadTexture(t);
+}
+
+#define MemAlloc(size) track_alloc(size)
+#define MemRealloc(ptr, size) track_realloc(ptr, size)
+#define MemFree(ptr) track_free(ptr)
+#define LoadTextureFromImage(img) track_load_texture(img)
+#define UnloadTexture(t) track_unload_texture(t)
+#endif
+
 
 #define DLRL_FALLBACK_SURFACE 512u
 #define DLRL_MAX_MARKER_NAME 64
+#define DLRL_MARKER_INDEX_BITS 16
+#define DLRL_MARKER_INDEX_MASK ((1u << DLRL_MARKER_INDEX_BITS) - 1u)
+#define DLRL_MARKER_GEN_MASK 0x7FFFu
+#define DLRL_MAX_ID 128
+#define DLRL_WARM_SLOTS 4
+#define DLRL_WARM_FRAMES 3
+#define DLRL_WARM_FRAMES_PER_UPDATE 1
+#define DLRL_POOL_CAP 64
+#define DLRL_POOL_DEFAULT_TEXTURES 8
+#define DLRL_POOL_MIN_EDGE 64
+#define DLRL_BAKE_MAX_SHEET 4096
+#define DLRL_BAKE_MAX_SHEETS 16
+#define DLRL_MAX_PATH 512
+#define DLRL_CACHE_MAGIC 0x43464C44u   /* "DLFC" */
+#define DLRL_CACHE_VERSION 1u
+#define DLRL_CACHE_KEYFRAME_INTERVAL 16
+#define DLRL_DRAW_CHUNK 256
+#define DLRL_MAX_FONT_NAME 128
+#define DLRL_MAX_LAYER_NAME 64
+#define DLRL_HIT_GRID_MAX 32
+#define DLRL_THEME_VARIANTS 4
 
 typedef struct {
     char name[DLRL_MAX_MARKER_NAME];
     float startFrame;
     float frameCount;
     float durationSeconds;
+    uint32_t hash;          /* case-folded FNV-1a of name */
 } dlrl_Marker;
 
+typedef enum {
+    DLRL_SOURCE_NONE,
+    DLRL_SOURCE_DOTLOTTIE,
+    DLRL_SOURCE_JSON,
+    DLRL_SOURCE_PATH
+} dlrl_SourceKind;
+
+/* A declared switch target whose first frames are rendered ahead of time. */
+typedef struct {
+    bool used;
+    bool isAnimation;
+    bool consumed;          /* animation slot whose core/texture moved into the player */
+    bool hit;
+    int marker;             /* marker index for marker slots */
+    char id[DLRL_MAX_ID];   /* marker label or animation id */
+    float startFrame;
+    int frameCount;         /* frames to hold: min(DLRL_WARM_FRAMES, segment frames) */
+    int framesReady;
+    float span;             /* segment length in frames minus one */
+    dlrl_Mode mode;         /* playback the held frames follow, see warm_frame */
+    float speedSign;
+    bool loop;
+    unsigned char* frames;  /* frameCount * w * h * 4 bytes */
+    int w, h;
+    /* animation slots only */
+    struct DotLottiePlayer* core;
+    bool themeStale;        /* core still has the previous theme; applied before warming */
+    Texture2D tex;
+    Vector2 natural;
+    float duration;
+    float totalFrames;
+} dlrl_WarmSlot;
+
+/* Every frame of one segment rasterized into sprite sheets; playback only picks a cell. */
+typedef struct {
+    bool wanted;            /* kept across eviction so the sheets are rebuilt on restore */
+    int marker;             /* baked segment, DLRL_NO_MARKER for the full timeline */
+    dlrl_BakeFormat format; /* requested encoding */
+    dlrl_BakeFormat actual; /* encoding the GPU accepted */
+    Texture2D sheets[DLRL_BAKE_MAX_SHEETS];
+    int sheetCount;
+    int cellW, cellH;       /* frame size padded to the 4x4 block grid */
+    int cols, perSheet;
+    int frameCount;
+    float startFrame;
+    int frame;              /* cell picked by the last dlrl_Update */
+    size_t bytes;
+} dlrl_Bake;
+
+enum { DLRL_CACHE_MISSING, DLRL_CACHE_INTRA, DLRL_CACHE_DELTA };
+
+/* On-disk layout: header, one entry per frame, then word-aligned RLE blobs. */
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t assetHash;     /* FNV-1a of the source bytes */
+    uint64_t keyHash;       /* animation id, theme and background color */
+    uint32_t width, height;
+    uint32_t frameCount;
+    uint32_t reserved;
+} dlrl_CacheHeader;
+
+typedef struct {
+    uint32_t offset;
+    uint32_t size;          /* bytes */
+    uint32_t kind;          /* DLRL_CACHE_* */
+} dlrl_CacheEntry;
+
+typedef struct {
+    uint32_t* data;
+    size_t words;
+    uint32_t kind;
+} dlrl_CacheBlob;
+
+typedef struct {
+    bool enabled;
+    bool assetHashed;
+    uint64_t assetHash;
+    uint64_t keyHash;
+    char path[DLRL_MAX_PATH + 32];
+    int w, h;
+    int frameCount;
+    const unsigned char* map;
+    size_t mapSize;
+    const dlrl_CacheEntry* entries; /* NULL unless the mapped file validated */
+    dlrl_CacheBlob* pending;        /* frames rendered since the last flush, per frame */
+    int pendingCount;
+    uint32_t* frame;                /* last decoded or rendered frame, base for delta coding */
+    int frameIndex;
+    uint32_t* scratch;              /* two RLE outputs of n + 16 words */
+    int hits, misses;
+} dlrl_FrameCache;
+
+/* Bounds of one named layer, reused until the core moves to another frame. */
+typedef struct {
+    char name[DLRL_MAX_LAYER_NAME];
+    bool hit;               /* registered with dlrl_AddHitLayer */
+    bool cached;
+    bool valid;
+    float frame;            /* coreFrame the box belongs to */
+    uint32_t content;       /* contentSerial the box belongs to */
+    LayerBoundingBox box;   /* surface pixels */
+} dlrl_LayerCache;
+
+/* A second core with another theme already applied; dlrl_UseTheme swaps it, its bake and cache in. */
+typedef struct {
+    struct DotLottiePlayer* core;   /* NULL when the slot is free */
+    dlrl_ThemeHandle theme;
+    uint64_t lastUse;
+    dlrl_Bake bake;                 /* sheets rendered with this theme */
+    dlrl_FrameCache cache;          /* cache file keyed on this theme */
+} dlrl_ThemeVariant;
+
+/* Interned theme: a bundle theme id or inline theme JSON. Handle = index + 1. */
+typedef struct {
+    bool data;
+    char* text;             /* NULL while the slot is on the free list */
+    uint64_t hash;
+    int refs;               /* dlrl_ThemeFrom* callers plus players and variants using it */
+    int next;               /* next handle in the hash bucket or free list, 0 at the end */
+} dlrl_ThemeEntry;
+
 struct dlrl_Player {
     struct DotLottiePlayer* core;
     Texture2D tex;
@@ -22,7 +283,12 @@ struct dlrl_Player {
     uint32_t requestedH;
     bool autoWidth;
     bool autoHeight;
-    float time;
+    double time;         /* position inside the segment, derived from phase */
+    double phase;        /* cursor along one play cycle; see cycle_length */
+    double accum;        /* unconsumed real time in fixed-step mode */
+    double fixedStep;    /* seconds per step; 0 advances by the raw dt */
+    bool completed;
+    dlrl_StepInfo lastStep;
     float duration;      
     float assetDuration; 
     int totalFrames;
@@ -39,10 +305,94 @@ struct dlrl_Player {
     Vector2 natural; 
     dlrl_Marker* markers;
     int markerCount;
+    int* markerTable;       /* open-addressed hash of marker index + 1; 0 is empty */
+    uint32_t markerTableMask;
     int activeMarker;
-    float direction;
+    uint32_t markerGen;     /* bumped by every marker load; upper bits of each handle */
+    float speedSign;     /* -1 when a negative speed was requested */
+    dlrl_SourceKind sourceKind;
+    unsigned char* source;  /* .lottie blob, JSON text or path; kept for warm cores */
+    size_t sourceSize;
+    dlrl_ThemeHandle theme;
+    dlrl_ThemeVariant variants[DLRL_THEME_VARIANTS];
+    dlrl_WarmSlot warm[DLRL_WARM_SLOTS];
+    int warmNext;           /* round-robin victim when all slots are taken */
+    int servedSlot;         /* slot feeding frames to dlrl_Update, -1 when rendering live */
+    dlrl_WarmStats warmStats;
+    dlrl_Player* prev;      /* global registry used by the memory budget */
+    dlrl_Player* next;
+    uint64_t drawStamp;     /* value of the global draw counter at the last dlrl_Draw */
+    uint64_t canvasPass;    /* dlrl_UpdateCanvas call that last advanced this player */
+    size_t gpuBytes;        /* usage last reported to the global totals */
+    size_t cpuBytes;
+    bool evicted;           /* texture and pixel buffers released by the budget */
+    bool resizePending;     /* dlrl_Resize request waiting for the settle interval */
+    uint32_t pendingW, pendingH;
+    float resizeTimer;
+    dlrl_Bake bake;
+    dlrl_FrameCache cache;
+    const uint32_t* framePixels; /* CPU copy of the last presented frame, texW x texH */
+    float presentedFrame;        /* -1 after content changes */
+    uint32_t frameSerial;        /* bumped whenever the presented image changes */
+    float coreFrame;             /* last frame given to dotlottie_set_frame */
+    uint32_t contentSerial;      /* bumped on animation, theme and size changes */
+    dlrl_LayerCache* layerCache;
+    int layerCount, layerCap;
+    int hitLayers;               /* entries of layerCache with hit set */
+    bool drawn;                  /* drawFit/drawRotation hold the last dlrl_Draw */
+    uint64_t drawnAt;            /* draw counter at the last dlrl_Draw */
+    bool hitIndexed;             /* in the hit grid as last built */
+    Rectangle drawFit;
+    float drawRotation;
+    Rectangle drawAabb;          /* screen bounds when the hit grid was built */
 };
 
+typedef struct {
+    float x0, y0, x1, y1;
+    float cellW, cellH;
+    int cols, rows;
+    int cellStart[DLRL_HIT_GRID_MAX * DLRL_HIT_GRID_MAX + 1];
+    int cellFill[DLRL_HIT_GRID_MAX * DLRL_HIT_GRID_MAX];
+    dlrl_Player** items;
+    int itemCap;
+    int count;                   /* players indexed; 0 means empty */
+    uint32_t builtEpoch;
+    uint64_t seenCounter;        /* draw counter at the previous dlrl_HitTest */
+    uint64_t frameStart;         /* players last drawn at or before this are hidden */
+} dlrl_HitGrid;
+
+static struct {
+    dlrl_InitOptions opts;
+    dlrl_Player* players;
+    uint64_t drawCounter;
+    uint64_t canvasPasses;
+    size_t gpuBytes;
+    size_t cpuBytes;
+    int evictedCount;
+    Texture2D pool[DLRL_POOL_CAP];  /* idle textures, oldest first */
+    int poolCount;
+    size_t poolBytes;
+    char cacheDir[DLRL_MAX_PATH];
+    uint32_t hitEpoch;           /* bumped when a hit-testable player moves or goes away */
+    dlrl_ThemeEntry* themes;
+    int themeCount, themeCap;    /* slots in use or free, allocated */
+    int themeFree;               /* first free handle, 0 when none */
+    int* themeBuckets;           /* hash -> first handle, themeCap buckets */
+    uint64_t themeClock;         /* orders variant use for replacement */
+    dlrl_HitGrid grid;
+} g_dlrl;
+
+static void account_player(dlrl_Player* p);
+static void enforce_budget(const dlrl_Player* keep);
+static void clear_pool(void);
+static void cache_open(dlrl_Player* p);
+static void content_changed(dlrl_Player* p);
+static void settle_fonts(bool wait);
+static void clear_fonts(void);
+static void clear_themes(void);
+static void cache_close(dlrl_Player* p);
+static void free_bake_sheets(dlrl_Player* p);
+
 static void fit_rect(int srcW, int srcH, Rectangle dst, dlrl_Fit fit, Vector2 align, Rectangle* out)
 {
     float sx = dst.width  / (float)srcW;
@@ -84,12 +434,77 @@ static void set_dotlottie_string(struct DotLottieString* dst, const char* src)
     copy_capped(dst->value, sizeof(dst->value), src);
 }
 
-static float seconds_per_frame(const dlrl_Player* p)
+/* Time between asset frames: the first frame shows at 0 and the last at the full duration.
+ * Players and headless renders both map time through this, so their frames line up. */
+static float frame_step_seconds(float duration, int totalFrames)
 {
-    if (!p || p->assetDuration <= 0.f) return 0.f;
-    int frames = (p->totalFrames > 1) ? (p->totalFrames - 1) : p->totalFrames;
+    if (duration <= 0.f) return 0.f;
+    int frames = (totalFrames > 1) ? (totalFrames - 1) : totalFrames;
     if (frames <= 0) return 0.f;
-    return p->assetDuration / (float)frames;
+    return duration / (float)frames;
+}
+
+static float seconds_per_frame(const dlrl_Player* p)
+{
+    return p ? frame_step_seconds(p->assetDuration, p->totalFrames) : 0.f;
+}
+
+/* Bounce modes play out and back, so one cycle spans twice the segment. */
+static double cycle_length(const dlrl_Player* p)
+{
+    double d = (double)p->duration;
+    return (p->mode == DLRL_MODE_BOUNCE || p->mode == DLRL_MODE_REVERSE_BOUNCE) ? 2.0 * d : d;
+}
+
+static double phase_to_time(const dlrl_Player* p, double phase)
+{
+    double d = (double)p->duration;
+    switch (p->mode) {
+        case DLRL_MODE_FORWARD:        return phase;
+        case DLRL_MODE_REVERSE:        return d - phase;
+        case DLRL_MODE_BOUNCE:         return (phase <= d) ? phase : 2.0 * d - phase;
+        case DLRL_MODE_REVERSE_BOUNCE: return (phase <= d) ? d - phase : phase - d;
+    }
+    return phase;
+}
+
+static double time_to_phase(const dlrl_Player* p, double t)
+{
+    double d = (double)p->duration;
+    return (p->mode == DLRL_MODE_REVERSE || p->mode == DLRL_MODE_REVERSE_BOUNCE) ? d - t : t;
+}
+
+static void reset_timeline(dlrl_Player* p)
+{
+    p->phase = 0.0;
+    p->accum = 0.0;
+    p->completed = false;
+    p->time = phase_to_time(p, 0.0);
+}
+
+/* Closed-form advance along the cycle: constant time for any delta, counting wraps. */
+static void advance_phase(dlrl_Player* p, double delta, dlrl_StepInfo* info)
+{
+    double cycle = cycle_length(p);
+    if (cycle <= 0.0) return;
+    double next = p->phase + delta;
+    if (next >= 0.0 && next < cycle) {
+        p->phase = next;
+        return;
+    }
+    if (!p->loop) {
+        p->phase = (next >= cycle) ? cycle : 0.0;
+        if (!p->completed) {
+            p->completed = true;
+            info->completed = true;
+        }
+        return;
+    }
+    double k = floor(next / cycle);
+    p->phase = next - k * cycle;
+    if (p->phase < 0.0 || p->phase >= cycle) p->phase = 0.0;
+    double wraps = fabs(k);
+    info->loops += (wraps > 1e9) ? 1000000000 : (int)wraps;
 }
 
 static void apply_segment(dlrl_Player* p, float startFrame, float frameCount, float durationSeconds)
@@ -106,7 +521,7 @@ static void apply_segment(dlrl_Player* p, float startFrame, float frameCount, fl
         p->duration = (spf > 0.f) ? spf * span : p->assetDuration;
     }
     if (p->duration <= 0.f) p->duration = p->assetDuration > 0.f ? p->assetDuration : 1.f;
-    p->time = 0.f;
+    reset_timeline(p);
 }
 
 static bool equals_ignore_case(const char* a, const char* b)
@@ -121,9 +536,124 @@ static bool equals_ignore_case(const char* a, const char* b)
     return (*a == '\0' && *b == '\0');
 }
 
+/* Compare a NUL-terminated name against a counted one, ignoring case. */
+static bool equals_ignore_case_n(const char* a, const char* b, size_t blen)
+{
+    for (size_t i = 0; i < blen; ++i) {
+        if (a[i] == '\0' || tolower((unsigned char)a[i]) != tolower((unsigned char)b[i])) {
+            return false;
+        }
+    }
+    return a[blen] == '\0';
+}
+
+static uint32_t hash_ignore_case(const char* s, size_t len)
+{
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < len; ++i) {
+        h ^= (uint32_t)tolower((unsigned char)s[i]);
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static uint64_t hash64(uint64_t h, const void* data, size_t len)
+{
+    const unsigned char* b = (const unsigned char*)data;
+    for (size_t i = 0; i < len; ++i) {
+        h ^= b[i];
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+static int compare_markers(const void* a, const void* b)
+{
+    const dlrl_Marker* ma = (const dlrl_Marker*)a;
+    const dlrl_Marker* mb = (const dlrl_Marker*)b;
+    if (ma->startFrame < mb->startFrame) return -1;
+    if (ma->startFrame > mb->startFrame) return 1;
+    return strcmp(ma->name, mb->name);
+}
+
+static void free_markers(dlrl_Player* p)
+{
+    if (p->markers) MemFree(p->markers);
+    if (p->markerTable) MemFree(p->markerTable);
+    p->markers = NULL;
+    p->markerTable = NULL;
+    p->markerTableMask = 0;
+    p->markerCount = 0;
+    p->activeMarker = -1;
+}
+
+/* Build the case-folded lookup table; at most half full so probes stay short. */
+static void index_markers(dlrl_Player* p)
+{
+    uint32_t size = 8;
+    while (size < (uint32_t)p->markerCount * 2u) size <<= 1;
+    int* table = (int*)MemAlloc(sizeof(int) * size);
+    if (!table) return;
+    memset(table, 0, sizeof(int) * size);
+    for (int i = 0; i < p->markerCount; ++i) {
+        uint32_t slot = p->markers[i].hash & (size - 1);
+        while (table[slot] != 0) {
+            const dlrl_Marker* other = &p->markers[table[slot] - 1];
+            if (other->hash == p->markers[i].hash && equals_ignore_case(other->name, p->markers[i].name)) break;
+            slot = (slot + 1) & (size - 1);
+        }
+        if (table[slot] == 0) table[slot] = i + 1;  /* first (earliest) duplicate wins */
+    }
+    p->markerTable = table;
+    p->markerTableMask = size - 1;
+}
+
+static int find_marker_n(const dlrl_Player* p, const char* name, size_t len)
+{
+    if (!name) return -1;
+    uint32_t h = hash_ignore_case(name, len);
+    if (!p->markerTable) {
+        /* index_markers could not allocate; the sorted array still answers, just linearly. */
+        for (int i = 0; i < p->markerCount; ++i) {
+            if (p->markers[i].hash == h && equals_ignore_case_n(p->markers[i].name, name, len)) return i;
+        }
+        return -1;
+    }
+    uint32_t slot = h & p->markerTableMask;
+    while (p->markerTable[slot] != 0) {
+        int i = p->markerTable[slot] - 1;
+        if (p->markers[i].hash == h && equals_ignore_case_n(p->markers[i].name, name, len)) return i;
+        slot = (slot + 1) & p->markerTableMask;
+    }
+    return -1;
+}
+
+static int find_marker(const dlrl_Player* p, const char* name)
+{
+    return name ? find_marker_n(p, name, strlen(name)) : -1;
+}
+
+/* Handles carry the load generation above the index so one kept across dlrl_SetAnimation
+ * is rejected instead of selecting whatever marker now sits at that index. */
+static dlrl_MarkerHandle marker_handle(const dlrl_Player* p, int index)
+{
+    if (index < 0) return DLRL_NO_MARKER;
+    return (dlrl_MarkerHandle)((p->markerGen << DLRL_MARKER_INDEX_BITS) | (uint32_t)index);
+}
+
+static int marker_index(const dlrl_Player* p, dlrl_MarkerHandle marker)
+{
+    if (marker < 0) return -1;
+    uint32_t h = (uint32_t)marker;
+    if ((h >> DLRL_MARKER_INDEX_BITS) != p->markerGen) return -1;
+    int index = (int)(h & DLRL_MARKER_INDEX_MASK);
+    return index < p->markerCount ? index : -1;
+}
+
 static void load_markers(dlrl_Player* p)
 {
     if (!p) return;
+    p->markerGen = (p->markerGen + 1u) & DLRL_MARKER_GEN_MASK;
     size_t needed = 0;
     if (dotlottie_markers(p->core, NULL, &needed) != DOTLOTTIE_SUCCESS || needed == 0) {
         return;
@@ -135,6 +665,7 @@ static void load_markers(dlrl_Player* p)
         MemFree(raw);
         return;
     }
+    if (count > DLRL_MARKER_INDEX_MASK + 1u) count = DLRL_MARKER_INDEX_MASK + 1u;
     dlrl_Marker* markers = MemAlloc(sizeof(dlrl_Marker) * count);
     if (!markers) {
         MemFree(raw);
@@ -148,29 +679,37 @@ static void load_markers(dlrl_Player* p)
         m->frameCount = (raw[i].duration > 0.f) ? raw[i].duration : 1.f;
         float span = (m->frameCount > 1.f) ? (m->frameCount - 1.f) : m->frameCount;
         m->durationSeconds = (spf > 0.f) ? spf * span : 0.f;
+        m->hash = hash_ignore_case(m->name, strlen(m->name));
     }
-    
-    for (size_t i = 0; i < count; ++i) {
-        size_t minIndex = i;
-        for (size_t j = i + 1; j < count; ++j) {
-            if (markers[j].startFrame < markers[minIndex].startFrame) {
-                minIndex = j;
-            }
-        }
-        if (minIndex != i) {
-            dlrl_Marker tmp = markers[i];
-            markers[i] = markers[minIndex];
-            markers[minIndex] = tmp;
-        }
-    }
+    qsort(markers, count, sizeof(dlrl_Marker), compare_markers);
     p->markers = markers;
     p->markerCount = (int)count;
     p->activeMarker = -1;
+    index_markers(p);
     MemFree(raw);
 }
 
-bool dlrl_Init(void)   { return true; }
-void dlrl_Shutdown(void){}
+bool dlrl_Init(void)   { return dlrl_InitEx(NULL); }
+
+bool dlrl_InitEx(const dlrl_InitOptions* opts)
+{
+    g_dlrl.opts = opts ? *opts : (dlrl_InitOptions){0};
+    copy_capped(g_dlrl.cacheDir, sizeof(g_dlrl.cacheDir), g_dlrl.opts.cache_dir);
+    g_dlrl.opts.cache_dir = NULL;
+    if (g_dlrl.cacheDir[0] && !DirectoryExists(g_dlrl.cacheDir)) MakeDirectory(g_dlrl.cacheDir);
+    return true;
+}
+
+void dlrl_Shutdown(void)
+{
+    clear_pool();
+    clear_fonts();
+    clear_themes();
+    if (g_dlrl.grid.items) MemFree(g_dlrl.grid.items);
+    g_dlrl.grid = (dlrl_HitGrid){0};
+    g_dlrl.opts = (dlrl_InitOptions){0};
+    g_dlrl.cacheDir[0] = '\0';
+}
 
 static struct DotLottiePlayer* make_core(const dlrl_Config* cfg)
 {
@@ -200,6 +739,141 @@ static struct DotLottiePlayer* make_core(const dlrl_Config* cfg)
     return core;
 }
 
+static const dlrl_ThemeEntry* theme_entry(dlrl_ThemeHandle theme)
+{
+    if (theme <= 0 || theme > g_dlrl.themeCount) return NULL;
+    const dlrl_ThemeEntry* e = &g_dlrl.themes[theme - 1];
+    return e->text ? e : NULL;
+}
+
+static uint64_t theme_hash(dlrl_ThemeHandle theme)
+{
+    const dlrl_ThemeEntry* e = theme_entry(theme);
+    return e ? e->hash : 0;
+}
+
+static int* theme_bucket(uint64_t hash)
+{
+    return &g_dlrl.themeBuckets[hash & (uint64_t)(g_dlrl.themeCap - 1)];
+}
+
+/* Double the table; the bucket count follows the capacity so chains stay short. */
+static bool grow_themes(void)
+{
+    int cap = g_dlrl.themeCap ? g_dlrl.themeCap * 2 : 8;
+    dlrl_ThemeEntry* grown = (dlrl_ThemeEntry*)MemRealloc(g_dlrl.themes, (unsigned int)(sizeof(dlrl_ThemeEntry) * (size_t)cap));
+    if (!grown) return false;
+    g_dlrl.themes = grown;
+    int* buckets = (int*)MemAlloc((unsigned int)(sizeof(int) * (size_t)cap));
+    if (!buckets) return false;
+    memset(buckets, 0, sizeof(int) * (size_t)cap);
+    if (g_dlrl.themeBuckets) MemFree(g_dlrl.themeBuckets);
+    g_dlrl.themeBuckets = buckets;
+    g_dlrl.themeCap = cap;
+    for (int i = 0; i < g_dlrl.themeCount; ++i) {
+        dlrl_ThemeEntry* e = &g_dlrl.themes[i];
+        if (!e->text) continue;
+        int* head = theme_bucket(e->hash);
+        e->next = *head;
+        *head = i + 1;
+    }
+    return true;
+}
+
+/* Return the handle for the theme with one more reference, adding it on first use. */
+static dlrl_ThemeHandle intern_theme(bool data, const char* text)
+{
+    if (!text || !text[0]) return DLRL_DEFAULT_THEME;
+    size_t len = strlen(text);
+    unsigned char kind = data ? 1 : 0;
+    uint64_t h = hash64(hash64(14695981039346656037ull, &kind, 1), text, len);
+    if (g_dlrl.themeCap) {
+        for (int i = *theme_bucket(h); i; i = g_dlrl.themes[i - 1].next) {
+            dlrl_ThemeEntry* e = &g_dlrl.themes[i - 1];
+            if (e->hash == h && e->data == data && strcmp(e->text, text) == 0) {
+                e->refs++;
+                return i;
+            }
+        }
+    }
+    if (!g_dlrl.themeFree && g_dlrl.themeCount == g_dlrl.themeCap && !grow_themes()) return DLRL_INVALID_THEME;
+    char* copy = (char*)MemAlloc((unsigned int)(len + 1));
+    if (!copy) return DLRL_INVALID_THEME;
+    memcpy(copy, text, len + 1);
+
+    int handle = g_dlrl.themeFree;
+    if (handle) g_dlrl.themeFree = g_dlrl.themes[handle - 1].next;
+    else handle = ++g_dlrl.themeCount;
+    int* head = theme_bucket(h);
+    g_dlrl.themes[handle - 1] = (dlrl_ThemeEntry){ .data = data, .text = copy, .hash = h, .refs = 1, .next = *head };
+    *head = handle;
+    return handle;
+}
+
+static void retain_theme(dlrl_ThemeHandle theme)
+{
+    if (theme_entry(theme)) g_dlrl.themes[theme - 1].refs++;
+}
+
+/* Drop one reference; the last one frees the text and recycles the handle. */
+static void release_theme(dlrl_ThemeHandle theme)
+{
+    if (!theme_entry(theme)) return;
+    dlrl_ThemeEntry* e = &g_dlrl.themes[theme - 1];
+    if (--e->refs > 0) return;
+    for (int* link = theme_bucket(e->hash); *link; link = &g_dlrl.themes[*link - 1].next) {
+        if (*link == theme) {
+            *link = e->next;
+            break;
+        }
+    }
+    MemFree(e->text);
+    *e = (dlrl_ThemeEntry){ .next = g_dlrl.themeFree };
+    g_dlrl.themeFree = theme;
+}
+
+static void clear_themes(void)
+{
+    for (int i = 0; i < g_dlrl.themeCount; ++i) {
+        if (g_dlrl.themes[i].text) MemFree(g_dlrl.themes[i].text);
+    }
+    if (g_dlrl.themes) MemFree(g_dlrl.themes);
+    if (g_dlrl.themeBuckets) MemFree(g_dlrl.themeBuckets);
+    g_dlrl.themes = NULL;
+    g_dlrl.themeBuckets = NULL;
+    g_dlrl.themeCount = g_dlrl.themeCap = g_dlrl.themeFree = 0;
+}
+
+static bool apply_theme(struct DotLottiePlayer* core, dlrl_ThemeHandle theme)
+{
+    const dlrl_ThemeEntry* e = theme_entry(theme);
+    if (!e) return dotlottie_reset_theme(core) == DOTLOTTIE_SUCCESS;
+    if (e->data) return dotlottie_set_theme_data(core, e->text) == DOTLOTTIE_SUCCESS;
+    return dotlottie_set_theme(core, e->text) == DOTLOTTIE_SUCCESS;
+}
+
+static void register_player(dlrl_Player* p)
+{
+    p->prev = NULL;
+    p->next = g_dlrl.players;
+    if (g_dlrl.players) g_dlrl.players->prev = p;
+    g_dlrl.players = p;
+    p->drawStamp = ++g_dlrl.drawCounter;
+}
+
+static void unregister_player(dlrl_Player* p)
+{
+    if (p->prev) p->prev->next = p->next;
+    else if (g_dlrl.players == p) g_dlrl.players = p->next;
+    if (p->next) p->next->prev = p->prev;
+    p->prev = p->next = NULL;
+    g_dlrl.gpuBytes -= p->gpuBytes;
+    g_dlrl.cpuBytes -= p->cpuBytes;
+    if (p->evicted) g_dlrl.evictedCount--;
+    p->gpuBytes = p->cpuBytes = 0;
+    if (p->hitLayers > 0) g_dlrl.hitEpoch++;
+}
+
 static dlrl_Player* alloc_player(void)
 {
     dlrl_Player* p = (dlrl_Player*)MemAlloc(sizeof(dlrl_Player));
@@ -207,32 +881,105 @@ static dlrl_Player* alloc_player(void)
     return p;
 }
 
-static bool create_texture(dlrl_Player* p)
+static Texture2D make_texture(int w, int h)
 {
-    if (!p) return false;
     Image img = {
         .data = NULL,
-        .width = p->texW,
-        .height = p->texH,
+        .width = w,
+        .height = h,
         .mipmaps = 1,
         .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
     };
-    p->tex = LoadTextureFromImage(img); 
+    return LoadTextureFromImage(img);
+}
+
+static size_t surface_bytes(int w, int h)
+{
+    return (size_t)w * (size_t)h * 4u;
+}
+
+/* Round an edge up to its size bucket: caller-defined list, else powers of two. */
+static int bucket_edge(int n)
+{
+    const dlrl_InitOptions* o = &g_dlrl.opts;
+    if (o->texture_buckets && o->texture_bucket_count > 0) {
+        int best = 0;
+        for (int i = 0; i < o->texture_bucket_count; ++i) {
+            int b = o->texture_buckets[i];
+            if (b >= n && (best == 0 || b < best)) best = b;
+        }
+        return best ? best : n;
+    }
+    int e = DLRL_POOL_MIN_EDGE;
+    while (e < n) e <<= 1;
+    return e;
+}
+
+static void pool_drop_oldest(void)
+{
+    if (g_dlrl.poolCount == 0) return;
+    Texture2D t = g_dlrl.pool[0];
+    g_dlrl.poolBytes -= surface_bytes(t.width, t.height);
+    UnloadTexture(t);
+    --g_dlrl.poolCount;
+    memmove(&g_dlrl.pool[0], &g_dlrl.pool[1], sizeof(Texture2D) * (size_t)g_dlrl.poolCount);
+}
+
+/* Borrow a texture of the bucket covering w x h; reuses an idle one before allocating. */
+static Texture2D acquire_texture(int w, int h)
+{
+    int bw = bucket_edge(w);
+    int bh = bucket_edge(h);
+    for (int i = g_dlrl.poolCount - 1; i >= 0; --i) {
+        Texture2D t = g_dlrl.pool[i];
+        if (t.width != bw || t.height != bh) continue;
+        g_dlrl.poolBytes -= surface_bytes(t.width, t.height);
+        --g_dlrl.poolCount;
+        memmove(&g_dlrl.pool[i], &g_dlrl.pool[i + 1], sizeof(Texture2D) * (size_t)(g_dlrl.poolCount - i));
+        return t;
+    }
+    return make_texture(bw, bh);
+}
+
+static void release_texture(Texture2D t)
+{
+    if (t.id == 0) return;
+    int cap = g_dlrl.opts.pool_max_textures > 0 ? g_dlrl.opts.pool_max_textures : DLRL_POOL_DEFAULT_TEXTURES;
+    if (cap > DLRL_POOL_CAP) cap = DLRL_POOL_CAP;
+    while (g_dlrl.poolCount >= cap) pool_drop_oldest();
+    g_dlrl.pool[g_dlrl.poolCount++] = t;
+    g_dlrl.poolBytes += surface_bytes(t.width, t.height);
+}
+
+static void clear_pool(void)
+{
+    while (g_dlrl.poolCount > 0) pool_drop_oldest();
+}
+
+/* Frames occupy the top-left w x h of a possibly larger pooled texture. */
+static void upload_frame(Texture2D tex, int w, int h, const void* pixels)
+{
+    if (tex.id == 0 || !pixels) return;
+    UpdateTextureRec(tex, (Rectangle){0, 0, (float)w, (float)h}, pixels);
+}
+
+static bool create_texture(dlrl_Player* p)
+{
+    if (!p) return false;
+    p->tex = acquire_texture(p->texW, p->texH);
     return (p->tex.id != 0);
 }
 
 static bool recreate_texture(dlrl_Player* p, uint32_t w, uint32_t h)
 {
     if (!p) return false;
-    if ((int)w == p->texW && (int)h == p->texH && p->tex.id != 0) {
-        return true;
-    }
-    if (p->tex.id) {
-        UnloadTexture(p->tex);
-        p->tex = (Texture2D){0};
-    }
     p->texW = (int)w;
     p->texH = (int)h;
+    if (p->tex.id != 0 && p->tex.width == bucket_edge(p->texW) && p->tex.height == bucket_edge(p->texH)) {
+        return true;
+    }
+    release_texture(p->tex);
+    p->tex = (Texture2D){0};
     return create_texture(p);
 }
 
@@ -273,35 +1020,37 @@ static bool read_binary_file(const char* path, unsigned char** outData, size_t*
     return true;
 }
 
-dlrl_Player* dlrl_LoadDotLottieFile(const char* path, const dlrl_Config* cfg)
+static bool load_source(struct DotLottiePlayer* core, dlrl_SourceKind kind,
+                        const unsigned char* data, size_t size, uint32_t w, uint32_t h)
 {
-    if (!path) return NULL;
-    struct DotLottiePlayer* core = make_core(cfg);
-    if (!core) return NULL;
-
-    uint32_t requestedW = (uint32_t)(cfg && cfg->width  > 0 ? cfg->width  : 0);
-    uint32_t requestedH = (uint32_t)(cfg && cfg->height > 0 ? cfg->height : 0);
-    uint32_t loadW = requestedW ? requestedW : DLRL_FALLBACK_SURFACE;
-    uint32_t loadH = requestedH ? requestedH : DLRL_FALLBACK_SURFACE;
-
-    bool isDotLottie = ends_with_ci(path, ".lottie");
     int status = DOTLOTTIE_ERROR;
-    unsigned char* blob = NULL;
-    size_t blobSize = 0;
-    if (isDotLottie) {
-        if (read_binary_file(path, &blob, &blobSize)) {
-            status = dotlottie_load_dotlottie_data(core, (const char*)blob, blobSize, loadW, loadH);
-            MemFree(blob);
-        }
-    } else {
-        status = dotlottie_load_animation_path(core, path, loadW, loadH);
+    switch (kind) {
+        case DLRL_SOURCE_DOTLOTTIE:
+            status = dotlottie_load_dotlottie_data(core, (const char*)data, size, w, h);
+            break;
+        case DLRL_SOURCE_JSON:
+            status = dotlottie_load_animation_data(core, (const char*)data, w, h);
+            break;
+        case DLRL_SOURCE_PATH:
+            status = dotlottie_load_animation_path(core, (const char*)data, w, h);
+            break;
+        case DLRL_SOURCE_NONE:
+            break;
     }
+    return status == DOTLOTTIE_SUCCESS;
+}
 
-    if (status != DOTLOTTIE_SUCCESS) {
-        dotlottie_destroy(core);
-        return NULL;
-    }
+typedef struct {
+    float naturalW, naturalH;
+    float duration;
+    float totalFrames;
+    uint32_t w, h;
+} dlrl_CoreInfo;
 
+/* Read size/timing of the freshly loaded animation and resize the surface to its final size. */
+static bool settle_core(struct DotLottiePlayer* core, uint32_t requestedW, uint32_t requestedH,
+                        uint32_t loadW, uint32_t loadH, dlrl_CoreInfo* out)
+{
     float naturalW = 0.f, naturalH = 0.f, duration = 0.f, totalFrames = 0.f;
     dotlottie_animation_size(core, &naturalW, &naturalH);
     dotlottie_duration(core, &duration);
@@ -312,23 +1061,63 @@ dlrl_Player* dlrl_LoadDotLottieFile(const char* path, const dlrl_Config* cfg)
 
     if ((targetW != loadW || targetH != loadH) &&
             dotlottie_resize(core, targetW, targetH) != DOTLOTTIE_SUCCESS) {
+        return false;
+    }
+    out->naturalW = naturalW;
+    out->naturalH = naturalH;
+    out->duration = duration;
+    out->totalFrames = totalFrames;
+    out->w = targetW;
+    out->h = targetH;
+    return true;
+}
+
+static void apply_core_info(dlrl_Player* p, const dlrl_CoreInfo* info)
+{
+    p->assetDuration = info->duration;
+    p->duration = info->duration;
+    p->totalFrames = info->totalFrames > 0.f ? (int)info->totalFrames : 1;
+    p->segmentStartFrame = 0.f;
+    p->segmentFrameCount = (float)p->totalFrames;
+    p->time = 0.f;
+    p->natural = (Vector2){info->naturalW, info->naturalH};
+    reset_timeline(p);
+}
+
+/* Takes ownership of `source`; it is kept so warm cores can load sibling animations. */
+static dlrl_Player* create_player(dlrl_SourceKind kind, unsigned char* source, size_t sourceSize,
+                                  const dlrl_Config* cfg)
+{
+    settle_fonts(true);
+    struct DotLottiePlayer* core = make_core(cfg);
+    if (!core) { MemFree(source); return NULL; }
+
+    uint32_t requestedW = (uint32_t)(cfg && cfg->width  > 0 ? cfg->width  : 0);
+    uint32_t requestedH = (uint32_t)(cfg && cfg->height > 0 ? cfg->height : 0);
+    uint32_t loadW = requestedW ? requestedW : DLRL_FALLBACK_SURFACE;
+    uint32_t loadH = requestedH ? requestedH : DLRL_FALLBACK_SURFACE;
+
+    dlrl_CoreInfo info;
+    if (!load_source(core, kind, source, sourceSize, loadW, loadH) ||
+            !settle_core(core, requestedW, requestedH, loadW, loadH, &info)) {
         dotlottie_destroy(core);
+        MemFree(source);
         return NULL;
     }
 
     dlrl_Player* p = alloc_player();
-    if (!p) { dotlottie_destroy(core); return NULL; }
+    if (!p) { dotlottie_destroy(core); MemFree(source); return NULL; }
+    register_player(p);
     p->core = core;
-    p->texW = (int)targetW; p->texH = (int)targetH;
+    p->sourceKind = kind;
+    p->source = source;
+    p->sourceSize = sourceSize;
+    p->texW = (int)info.w; p->texH = (int)info.h;
     p->requestedW = requestedW;
     p->requestedH = requestedH;
     p->autoWidth = (requestedW == 0);
     p->autoHeight = (requestedH == 0);
-    p->assetDuration = duration;
-    p->duration = duration;
-    p->totalFrames = totalFrames > 0.f ? (int)totalFrames : 1;
-    p->segmentStartFrame = 0.f;
-    p->segmentFrameCount = (float)p->totalFrames;
+    apply_core_info(p, &info);
     p->speed = cfg ? (cfg->speed ? cfg->speed : 1.f) : 1.f;
     p->loop = cfg ? cfg->loop : true;
     p->mode = cfg ? cfg->mode : DLRL_MODE_FORWARD;
@@ -336,13 +1125,17 @@ dlrl_Player* dlrl_LoadDotLottieFile(const char* path, const dlrl_Config* cfg)
     p->fit = cfg ? cfg->fit : DLRL_FIT_CONTAIN;
     p->align = cfg ? cfg->align : (Vector2){0.5f, 0.5f};
     p->bg = cfg ? cfg->background : BLANK;
-    p->direction = (p->mode == DLRL_MODE_REVERSE || p->mode == DLRL_MODE_REVERSE_BOUNCE) ? -1.f : 1.f;
-    if (p->speed < 0.f) { p->direction = -p->direction; p->speed = -p->speed; }
+    p->speedSign = 1.f;
+    if (p->speed < 0.f) { p->speedSign = -1.f; p->speed = -p->speed; }
+    reset_timeline(p);
+    p->theme = (cfg && cfg->theme_id) ? intern_theme(false, cfg->theme_id) : DLRL_DEFAULT_THEME;
+    if (p->theme == DLRL_INVALID_THEME) p->theme = DLRL_DEFAULT_THEME;
+    p->cache.enabled = cfg ? cfg->frame_cache : false;
 
-    p->natural = (Vector2){naturalW, naturalH};
     p->markers = NULL;
     p->markerCount = 0;
     p->activeMarker = -1;
+    p->servedSlot = -1;
 
     if (!create_texture(p)) { dlrl_Unload(p); return NULL; }
 
@@ -350,276 +1143,2959 @@ dlrl_Player* dlrl_LoadDotLottieFile(const char* path, const dlrl_Config* cfg)
     if (cfg && cfg->marker && cfg->marker[0]) {
         dlrl_SetMarker(p, cfg->marker);
     }
+    content_changed(p);
 
+    account_player(p);
+    enforce_budget(p);
     return p;
 }
 
+dlrl_Player* dlrl_LoadDotLottieFile(const char* path, const dlrl_Config* cfg)
+{
+    if (!path) return NULL;
+    unsigned char* source = NULL;
+    size_t sourceSize = 0;
+    if (ends_with_ci(path, ".lottie")) {
+        if (!read_binary_file(path, &source, &sourceSize)) return NULL;
+        return create_player(DLRL_SOURCE_DOTLOTTIE, source, sourceSize, cfg);
+    }
+    sourceSize = strlen(path);
+    source = (unsigned char*)MemAlloc(sourceSize + 1);
+    if (!source) return NULL;
+    memcpy(source, path, sourceSize + 1);
+    return create_player(DLRL_SOURCE_PATH, source, sourceSize, cfg);
+}
+
 dlrl_Player* dlrl_LoadLottieJSON(const char* json, size_t len, const dlrl_Config* cfg)
 {
     if (!json || len == 0) return NULL;
-    struct DotLottiePlayer* core = make_core(cfg);
-    if (!core) return NULL;
-
-    uint32_t requestedW = (uint32_t)(cfg && cfg->width  > 0 ? cfg->width  : 0);
-    uint32_t requestedH = (uint32_t)(cfg && cfg->height > 0 ? cfg->height : 0);
-    uint32_t loadW = requestedW ? requestedW : DLRL_FALLBACK_SURFACE;
-    uint32_t loadH = requestedH ? requestedH : DLRL_FALLBACK_SURFACE;
     char* buf = (char*)MemAlloc(len + 1);
-    if (!buf) {
-        dotlottie_destroy(core);
-        return NULL;
-    }
+    if (!buf) return NULL;
     memcpy(buf, json, len);
     buf[len] = '\0';
+    return create_player(DLRL_SOURCE_JSON, (unsigned char*)buf, len, cfg);
+}
 
-    int status = dotlottie_load_animation_data(core, buf, loadW, loadH);
-    MemFree(buf);
-    if (status != DOTLOTTIE_SUCCESS) {
-        dotlottie_destroy(core);
-        return NULL;
+static void player_config(const dlrl_Player* p, const char* animation_id, dlrl_Config* out)
+{
+    *out = (dlrl_Config){0};
+    out->speed = p->speed;
+    out->loop = p->loop;
+    out->mode = p->mode;
+    out->interpolate = p->interpolate;
+    out->background = p->bg;
+    out->animation_id = animation_id;
+}
+
+static size_t warm_frame_bytes(const dlrl_WarmSlot* s)
+{
+    return (size_t)s->w * (size_t)s->h * 4u;
+}
+
+static void release_warm_slot(dlrl_Player* p, int index)
+{
+    dlrl_WarmSlot* s = &p->warm[index];
+    if (!s->used) return;
+    if (!s->hit) p->warmStats.wasted++;
+    if (s->frames) MemFree(s->frames);
+    release_texture(s->tex);
+    if (s->core) dotlottie_destroy(s->core);
+    if (p->servedSlot == index) p->servedSlot = -1;
+    *s = (dlrl_WarmSlot){0};
+}
+
+static void release_warm_slots(dlrl_Player* p, bool markersOnly)
+{
+    for (int i = 0; i < DLRL_WARM_SLOTS; ++i) {
+        if (markersOnly && p->warm[i].isAnimation) continue;
+        release_warm_slot(p, i);
     }
+}
 
-    float naturalW = 0.f, naturalH = 0.f, duration = 0.f, totalFrames = 0.f;
-    dotlottie_animation_size(core, &naturalW, &naturalH);
-    dotlottie_duration(core, &duration);
-    dotlottie_total_frames(core, &totalFrames);
+static int find_warm_animation(const dlrl_Player* p, const char* animation_id)
+{
+    for (int i = 0; i < DLRL_WARM_SLOTS; ++i) {
+        const dlrl_WarmSlot* s = &p->warm[i];
+        if (s->used && !s->consumed && s->isAnimation && strcmp(s->id, animation_id) == 0) return i;
+    }
+    return -1;
+}
 
-    uint32_t targetW = requestedW ? requestedW : (naturalW > 0.f ? (uint32_t)naturalW : loadW);
-    uint32_t targetH = requestedH ? requestedH : (naturalH > 0.f ? (uint32_t)naturalH : loadH);
+static int find_warm_marker(const dlrl_Player* p, int marker)
+{
+    for (int i = 0; i < DLRL_WARM_SLOTS; ++i) {
+        const dlrl_WarmSlot* s = &p->warm[i];
+        if (s->used && !s->isAnimation && s->marker == marker) return i;
+    }
+    return -1;
+}
 
-    if ((targetW != loadW || targetH != loadH) &&
-            dotlottie_resize(core, targetW, targetH) != DOTLOTTIE_SUCCESS) {
-        dotlottie_destroy(core);
-        return NULL;
+static dlrl_WarmSlot* claim_warm_slot(dlrl_Player* p)
+{
+    for (int i = 0; i < DLRL_WARM_SLOTS; ++i) {
+        if (!p->warm[i].used) return &p->warm[i];
     }
+    int victim = p->warmNext;
+    if (victim == p->servedSlot) victim = (victim + 1) % DLRL_WARM_SLOTS;
+    p->warmNext = (victim + 1) % DLRL_WARM_SLOTS;
+    release_warm_slot(p, victim);
+    return &p->warm[victim];
+}
 
-    dlrl_Player* p = alloc_player();
-    if (!p) { dotlottie_destroy(core); return NULL; }
-    p->core = core;
-    p->texW = (int)targetW; p->texH = (int)targetH;
-    p->requestedW = requestedW;
-    p->requestedH = requestedH;
-    p->autoWidth = (requestedW == 0);
-    p->autoHeight = (requestedH == 0);
-    p->assetDuration = duration;
-    p->duration = duration;
-    p->totalFrames = totalFrames > 0.f ? (int)totalFrames : 1;
-    p->segmentStartFrame = 0.f;
-    p->segmentFrameCount = (float)p->totalFrames;
-    p->speed = cfg ? (cfg->speed ? cfg->speed : 1.f) : 1.f;
-    p->loop = cfg ? cfg->loop : true;
-    p->mode = cfg ? cfg->mode : DLRL_MODE_FORWARD;
-    p->interpolate = cfg ? cfg->interpolate : true;
-    p->fit = cfg ? cfg->fit : DLRL_FIT_CONTAIN;
-    p->align = cfg ? cfg->align : (Vector2){0.5f, 0.5f};
-    p->bg = cfg ? cfg->background : BLANK;
-    p->direction = (p->mode == DLRL_MODE_REVERSE || p->mode == DLRL_MODE_REVERSE_BOUNCE) ? -1.f : 1.f;
-    if (p->speed < 0.f) { p->direction = -p->direction; p->speed = -p->speed; }
+static void end_serving(dlrl_Player* p)
+{
+    int slot = p->servedSlot;
+    if (slot < 0) return;
+    p->servedSlot = -1;
+    if (p->warm[slot].consumed) release_warm_slot(p, slot);
+}
 
-    p->natural = (Vector2){naturalW, naturalH};
-    p->markers = NULL;
-    p->markerCount = 0;
-    p->activeMarker = -1;
+/* Record the playback the slot warms for; frames are only valid while the player still matches. */
+static void warm_track(const dlrl_Player* p, dlrl_WarmSlot* s, float span)
+{
+    s->span = (span > 0.f) ? span : 0.f;
+    s->mode = p->mode;
+    s->speedSign = p->speedSign;
+    s->loop = p->loop;
+}
 
-    if (!create_texture(p)) { dlrl_Unload(p); return NULL; }
+static bool warm_matches(const dlrl_Player* p, const dlrl_WarmSlot* s)
+{
+    return s->mode == p->mode && s->speedSign == p->speedSign && s->loop == p->loop;
+}
 
-    load_markers(p);
-    if (cfg && cfg->marker && cfg->marker[0]) {
-        dlrl_SetMarker(p, cfg->marker);
+/* k-th frame the segment shows from its play start (phase 0), one frame per step, in the
+ * direction set by the mode and speed sign; mirrors advance_phase and phase_to_time. */
+static float warm_frame(const dlrl_WarmSlot* s, int k)
+{
+    float n = s->span;
+    if (n <= 0.f) return s->startFrame;
+    bool bounce = (s->mode == DLRL_MODE_BOUNCE || s->mode == DLRL_MODE_REVERSE_BOUNCE);
+    float cycle = bounce ? 2.f * n : n;
+    float q = s->speedSign * (float)k;
+    if (s->loop) {
+        q = fmodf(q, cycle);
+        if (q < 0.f) q += cycle;
+    } else {
+        float end = bounce ? cycle : n;
+        q = (q < 0.f) ? 0.f : (q > end ? end : q);
+    }
+    float t = q;
+    switch (s->mode) {
+        case DLRL_MODE_FORWARD:        t = q; break;
+        case DLRL_MODE_REVERSE:        t = n - q; break;
+        case DLRL_MODE_BOUNCE:         t = (q <= n) ? q : 2.f * n - q; break;
+        case DLRL_MODE_REVERSE_BOUNCE: t = (q <= n) ? n - q : q - n; break;
     }
+    return s->startFrame + t;
+}
 
-    return p;
+/* Drop frames rendered under a previous theme; slots refill, and re-theme, on the next updates. */
+static void reset_warm_frames(dlrl_Player* p)
+{
+    end_serving(p);
+    for (int i = 0; i < DLRL_WARM_SLOTS; ++i) {
+        dlrl_WarmSlot* s = &p->warm[i];
+        if (!s->used) continue;
+        s->framesReady = 0;
+        if (s->core) s->themeStale = true;
+    }
 }
 
-void dlrl_Unload(dlrl_Player* p)
+/* Exchange the live core, theme, bake and frame cache with a variant's. */
+static void swap_variant(dlrl_Player* p, dlrl_ThemeVariant* v)
 {
-    if (!p) return;
-    if (p->tex.id) UnloadTexture(p->tex);
-    if (p->core) dotlottie_destroy(p->core);
-    if (p->markers) MemFree(p->markers);
-    MemFree(p);
+    struct DotLottiePlayer* core = p->core;
+    dlrl_ThemeHandle theme = p->theme;
+    dlrl_Bake bake = p->bake;
+    dlrl_FrameCache cache = p->cache;
+    p->core = v->core;
+    p->theme = v->theme;
+    p->bake = v->bake;
+    p->cache = v->cache;
+    v->core = core;
+    v->theme = theme;
+    v->bake = bake;
+    v->cache = cache;
 }
 
-void dlrl_Play(dlrl_Player* p){ if(!p) return; dotlottie_play(p->core); p->playing = true; }
-void dlrl_Pause(dlrl_Player* p){ if(!p) return; dotlottie_pause(p->core); p->playing = false; }
-void dlrl_Stop(dlrl_Player* p){
-    if(!p) return;
-    dotlottie_stop(p->core);
-    p->playing=false;
-    p->time=0.f;
-    p->direction = (p->mode == DLRL_MODE_REVERSE || p->mode == DLRL_MODE_REVERSE_BOUNCE) ? -1.f : 1.f;
-    dotlottie_set_frame(p->core, 0.f);
+static void drop_variant(dlrl_Player* p, dlrl_ThemeVariant* v)
+{
+    if (!v->core) return;
+    swap_variant(p, v);
+    free_bake_sheets(p);
+    cache_close(p);
+    swap_variant(p, v);
+    dotlottie_destroy(v->core);
+    release_theme(v->theme);
+    *v = (dlrl_ThemeVariant){0};
 }
-bool dlrl_IsPlaying(const dlrl_Player* p){ return p && p->playing; }
 
-void dlrl_SetSpeed(dlrl_Player* p, float speed){
-    if (!p) return;
-    if (speed < 0.f) {
-        p->direction = -1.f;
-        p->speed = -speed;
-    } else {
-        p->speed = speed;
-        if (p->direction == 0.f) p->direction = 1.f;
+static void release_variants(dlrl_Player* p)
+{
+    for (int i = 0; i < DLRL_THEME_VARIANTS; ++i) drop_variant(p, &p->variants[i]);
+}
+
+static dlrl_ThemeVariant* find_variant(dlrl_Player* p, dlrl_ThemeHandle theme)
+{
+    for (int i = 0; i < DLRL_THEME_VARIANTS; ++i) {
+        if (p->variants[i].core && p->variants[i].theme == theme) return &p->variants[i];
     }
+    return NULL;
 }
-void dlrl_SetLoop(dlrl_Player* p, bool loop){ if(p) p->loop = loop; }
-void dlrl_SetMode(dlrl_Player* p, dlrl_Mode m){
-    if(!p) return;
-    p->mode = m;
-    p->direction = (m == DLRL_MODE_REVERSE || m == DLRL_MODE_REVERSE_BOUNCE) ? -1.f : 1.f;
-    if (p->direction == 0.f) p->direction = 1.f;
+
+/* A free slot, else the least recently used variant after destroying its core. */
+static dlrl_ThemeVariant* claim_variant(dlrl_Player* p)
+{
+    dlrl_ThemeVariant* victim = &p->variants[0];
+    for (int i = 0; i < DLRL_THEME_VARIANTS; ++i) {
+        dlrl_ThemeVariant* v = &p->variants[i];
+        if (!v->core) return v;
+        if (v->lastUse < victim->lastUse) victim = v;
+    }
+    drop_variant(p, victim);
+    return victim;
 }
 
-static float wrap_time(dlrl_Player* p, float t)
+/* Load the active animation into a fresh core at the live size and apply `theme` to it. */
+static struct DotLottiePlayer* open_variant_core(dlrl_Player* p, dlrl_ThemeHandle theme)
 {
-    if (t < 0.f || t > p->duration) {
-        if (!p->loop) return (t < 0.f) ? 0.f : p->duration;
-        while (t < 0.f) t += p->duration;
-        while (t > p->duration) t -= p->duration;
+    char animationId[DOTLOTTIE_MAX_STR_LENGTH] = {0};
+    dotlottie_active_animation_id(p->core, animationId);
+    dlrl_Config cfg;
+    player_config(p, animationId[0] ? animationId : NULL, &cfg);
+    struct DotLottiePlayer* core = make_core(&cfg);
+    if (!core) return NULL;
+    if (!load_source(core, p->sourceKind, p->source, p->sourceSize, (uint32_t)p->texW, (uint32_t)p->texH) ||
+            !apply_theme(core, theme)) {
+        dotlottie_destroy(core);
+        return NULL;
     }
-    return t;
+    return core;
 }
 
-void dlrl_Update(dlrl_Player* p, float dt)
+static bool open_warm_animation(dlrl_Player* p, dlrl_WarmSlot* s)
 {
-    if (!p) return;
-    if (p->playing) {
-        float dir = (p->direction == 0.f) ? 1.f : p->direction;
-        switch (p->mode) {
-            case DLRL_MODE_FORWARD:
-                dir = 1.f;
-                break;
-            case DLRL_MODE_REVERSE:
-                dir = -1.f;
-                break;
-            case DLRL_MODE_BOUNCE:
-            case DLRL_MODE_REVERSE_BOUNCE:
-                if ((p->time <= 0.f && dir < 0.f) || (p->time >= p->duration && dir > 0.f)) {
-                    dir = -dir;
-                }
-                break;
-        }
-        p->direction = (dir == 0.f) ? 1.f : dir;
-        float s = p->speed * p->direction;
-        p->time = wrap_time(p, p->time + dt * s);
+    dlrl_Config cfg;
+    player_config(p, s->id, &cfg);
+    struct DotLottiePlayer* core = make_core(&cfg);
+    if (!core) return false;
+
+    uint32_t loadW = p->requestedW ? p->requestedW : DLRL_FALLBACK_SURFACE;
+    uint32_t loadH = p->requestedH ? p->requestedH : DLRL_FALLBACK_SURFACE;
+    dlrl_CoreInfo info;
+    if (!load_source(core, p->sourceKind, p->source, p->sourceSize, loadW, loadH) ||
+            !settle_core(core, p->requestedW, p->requestedH, loadW, loadH, &info)) {
+        dotlottie_destroy(core);
+        return false;
     }
+    if (p->theme != DLRL_DEFAULT_THEME) apply_theme(core, p->theme);
 
-    float normalized = (p->duration > 0.f) ? (p->time / p->duration) : 0.f;
-    if (normalized < 0.f) normalized = 0.f;
-    if (normalized > 1.f) normalized = 1.f;
-    float segmentSpan = (p->segmentFrameCount > 1.f) ? (p->segmentFrameCount - 1.f) : 0.f;
-    float targetFrame = p->segmentStartFrame + normalized * segmentSpan;
-    dotlottie_set_frame(p->core, targetFrame);
-    dotlottie_render(p->core);
+    s->w = (int)info.w;
+    s->h = (int)info.h;
+    s->startFrame = 0.f;
+    warm_track(p, s, info.totalFrames - 1.f);
+    s->frameCount = (info.totalFrames >= (float)DLRL_WARM_FRAMES) ? DLRL_WARM_FRAMES : 1;
+    s->frames = (unsigned char*)MemAlloc((unsigned int)(warm_frame_bytes(s) * (size_t)s->frameCount));
+    s->tex = acquire_texture(s->w, s->h);
+    if (!s->frames || s->tex.id == 0) {
+        dotlottie_destroy(core);
+        return false;
+    }
+    s->core = core;
+    s->natural = (Vector2){info.naturalW, info.naturalH};
+    s->duration = info.duration;
+    s->totalFrames = info.totalFrames;
+    return true;
+}
 
-    const uint32_t* ptr = NULL;
-    dotlottie_buffer_ptr(p->core, &ptr);
-    if (ptr && p->tex.id) {
-        UpdateTexture(p->tex, (const void*)ptr);
+/* Render a bounded number of pending warm frames; runs before the live frame each update. */
+static void warm_step(dlrl_Player* p)
+{
+    int budget = DLRL_WARM_FRAMES_PER_UPDATE;
+    for (int i = 0; i < DLRL_WARM_SLOTS && budget > 0; ++i) {
+        dlrl_WarmSlot* s = &p->warm[i];
+        if (!s->used || s->consumed) continue;
+        if (s->isAnimation && !s->core && !open_warm_animation(p, s)) {
+            release_warm_slot(p, i);
+            continue;
+        }
+        if (s->themeStale) {
+            apply_theme(s->core, p->theme);
+            s->themeStale = false;
+        }
+        if (!warm_matches(p, s)) {
+            if (p->servedSlot == i) end_serving(p);
+            warm_track(p, s, s->span);
+            s->framesReady = 0;
+        }
+        struct DotLottiePlayer* core = s->isAnimation ? s->core : p->core;
+        size_t bytes = warm_frame_bytes(s);
+        while (budget > 0 && s->framesReady < s->frameCount) {
+            const uint32_t* ptr = NULL;
+            dotlottie_set_frame(core, warm_frame(s, s->framesReady));
+            dotlottie_render(core);
+            dotlottie_buffer_ptr(core, &ptr);
+            --budget;
+            if (!ptr) break;
+            memcpy(s->frames + bytes * (size_t)s->framesReady, ptr, bytes);
+            if (s->isAnimation && s->framesReady == 0) upload_frame(s->tex, s->w, s->h, ptr);
+            s->framesReady++;
+            p->warmStats.frames_warmed++;
+        }
     }
 }
 
-void dlrl_Draw(const dlrl_Player* p, Rectangle dest, float rotation, Color tint)
+/* Return a held frame instead of rendering while the new segment is still inside its warm range. */
+static const uint32_t* serve_warm_frame(dlrl_Player* p, float targetFrame)
 {
-    if (!p || p->tex.id == 0) return;
+    if (p->servedSlot < 0) return NULL;
+    const dlrl_WarmSlot* s = &p->warm[p->servedSlot];
+    if (s->w == p->texW && s->h == p->texH) {
+        for (int k = 0; k < s->framesReady; ++k) {
+            if (fabsf(warm_frame(s, k) - targetFrame) > 0.5f) continue;
+            p->warmStats.frames_served++;
+            return (const uint32_t*)(s->frames + warm_frame_bytes(s) * (size_t)k);
+        }
+    }
+    end_serving(p);
+    return NULL;
+}
 
-    if (p->bg.a > 0) {
-        DrawRectangleRec(dest, p->bg);
+static uint16_t pack565(const int c[3])
+{
+    return (uint16_t)((((c[0] * 31 + 127) / 255) << 11) |
+                      (((c[1] * 63 + 127) / 255) << 5) |
+                       ((c[2] * 31 + 127) / 255));
+}
+
+static void unpack565(uint16_t v, int c[3])
+{
+    int r = (v >> 11) & 31, g = (v >> 5) & 63, b = v & 31;
+    c[0] = (r << 3) | (r >> 2);
+    c[1] = (g << 2) | (g >> 4);
+    c[2] = (b << 3) | (b >> 2);
+}
+
+/* BC1 color block from 16 RGBA pixels: inset bounding-box endpoints, nearest-palette indices.
+ * With punchThrough, pixels under half alpha select the transparent entry of 3-color mode. */
+static void encode_color_block(const unsigned char* px, bool punchThrough, unsigned char out[8])
+{
+    int lo[3] = {255, 255, 255}, hi[3] = {0, 0, 0};
+    bool transparent = false;
+    int opaque = 0;
+    for (int i = 0; i < 16; ++i) {
+        const unsigned char* c = px + i * 4;
+        if (punchThrough && c[3] < 128) { transparent = true; continue; }
+        ++opaque;
+        for (int ch = 0; ch < 3; ++ch) {
+            if (c[ch] < lo[ch]) lo[ch] = c[ch];
+            if (c[ch] > hi[ch]) hi[ch] = c[ch];
+        }
     }
+    if (opaque == 0) {
+        memset(out, 0, 4);
+        memset(out + 4, 0xFF, 4);
+        return;
+    }
+    /* The box has two ends per channel; pick the diagonal that follows the block's colors, so
+     * a channel falling while the widest one rises runs from its max to its min. */
+    int axis = 0;
+    for (int ch = 1; ch < 3; ++ch) {
+        if (hi[ch] - lo[ch] > hi[axis] - lo[axis]) axis = ch;
+    }
+    int cov[3] = {0, 0, 0};
+    for (int i = 0; i < 16; ++i) {
+        const unsigned char* c = px + i * 4;
+        if (punchThrough && c[3] < 128) continue;
+        int da = 2 * c[axis] - lo[axis] - hi[axis];
+        for (int ch = 0; ch < 3; ++ch) cov[ch] += da * (2 * c[ch] - lo[ch] - hi[ch]);
+    }
+    for (int ch = 0; ch < 3; ++ch) {
+        int inset = (hi[ch] - lo[ch]) >> 4;
+        lo[ch] += inset;
+        hi[ch] -= inset;
+        if (cov[ch] < 0) { int t = lo[ch]; lo[ch] = hi[ch]; hi[ch] = t; }
+    }
+    uint16_t c0 = pack565(hi), c1 = pack565(lo);
+    if (transparent ? (c0 > c1) : (c0 < c1)) { uint16_t t = c0; c0 = c1; c1 = t; }
 
-    Rectangle src = { 0, 0, (float)p->texW, (float)p->texH };
-    Rectangle fit = {0};
-    fit_rect(p->texW, p->texH, dest, p->fit, p->align, &fit);
-    Vector2 origin = { fit.width * 0.5f, fit.height * 0.5f };
-    Vector2 center = { fit.x + origin.x, fit.y + origin.y };
+    int pal[4][3];
+    unpack565(c0, pal[0]);
+    unpack565(c1, pal[1]);
+    int entries = 4;
+    if (c0 <= c1) {
+        for (int ch = 0; ch < 3; ++ch) pal[2][ch] = (pal[0][ch] + pal[1][ch]) / 2;
+        entries = 3;
+    } else {
+        for (int ch = 0; ch < 3; ++ch) {
+            pal[2][ch] = (2 * pal[0][ch] + pal[1][ch]) / 3;
+            pal[3][ch] = (pal[0][ch] + 2 * pal[1][ch]) / 3;
+        }
+    }
 
-    DrawTexturePro(p->tex, src,
-            (Rectangle){ center.x, center.y, fit.width, fit.height },
-            origin, rotation, tint);
+    uint32_t indices = 0;
+    for (int i = 0; i < 16; ++i) {
+        const unsigned char* c = px + i * 4;
+        int best = 0;
+        if (transparent && c[3] < 128) {
+            best = 3;
+        } else {
+            int bestDist = 0x7FFFFFFF;
+            for (int e = 0; e < entries; ++e) {
+                int dr = c[0] - pal[e][0], dg = c[1] - pal[e][1], db = c[2] - pal[e][2];
+                int d = dr * dr + dg * dg + db * db;
+                if (d < bestDist) { bestDist = d; best = e; }
+            }
+        }
+        indices |= (uint32_t)best << (2 * i);
+    }
+    out[0] = (unsigned char)(c0 & 0xFF); out[1] = (unsigned char)(c0 >> 8);
+    out[2] = (unsigned char)(c1 & 0xFF); out[3] = (unsigned char)(c1 >> 8);
+    for (int i = 0; i < 4; ++i) out[4 + i] = (unsigned char)(indices >> (8 * i));
 }
 
-float dlrl_Duration(const dlrl_Player* p){ return p ? p->duration : 0.f; }
-float dlrl_CurrentTime(const dlrl_Player* p){ return p ? p->time : 0.f; }
-int   dlrl_TotalFrames(const dlrl_Player* p){ float f=0; return (p && dotlottie_total_frames(p->core, &f)==0) ? (int)f : 0; }
-int   dlrl_CurrentFrame(const dlrl_Player* p){ float f=0; return (p && dotlottie_current_frame(p->core, &f)==0) ? (int)f : 0; }
-Vector2 dlrl_NaturalSize(const dlrl_Player* p){ return p ? p->natural : (Vector2){0,0}; }
-Texture2D dlrl_GetTexture(const dlrl_Player* p){ return p ? p->tex : (Texture2D){0}; }
+/* BC3 alpha block: min/max endpoints in 8-level mode, 3-bit nearest indices. */
+static void encode_alpha_block(const unsigned char* px, unsigned char out[8])
+{
+    int lo = 255, hi = 0;
+    for (int i = 0; i < 16; ++i) {
+        int a = px[i * 4 + 3];
+        if (a < lo) lo = a;
+        if (a > hi) hi = a;
+    }
+    uint64_t bits = 0;
+    if (hi > lo) {
+        int pal[8] = { hi, lo };
+        for (int i = 2; i < 8; ++i) pal[i] = ((8 - i) * hi + (i - 1) * lo) / 7;
+        for (int i = 0; i < 16; ++i) {
+            int a = px[i * 4 + 3];
+            int best = 0, bestDist = 256;
+            for (int e = 0; e < 8; ++e) {
+                int d = (a > pal[e]) ? a - pal[e] : pal[e] - a;
+                if (d < bestDist) { bestDist = d; best = e; }
+            }
+            bits |= (uint64_t)best << (3 * i);
+        }
+    }
+    out[0] = (unsigned char)hi;
+    out[1] = (unsigned char)lo;
+    for (int i = 0; i < 6; ++i) out[2 + i] = (unsigned char)(bits >> (8 * i));
+}
 
-bool dlrl_SetTheme(dlrl_Player* p, const char* theme_id)
+static void compress_blocks(const unsigned char* rgba, int w, int h, dlrl_BakeFormat format, unsigned char* out)
 {
-    if (!p) return false;
-    if (!theme_id || !theme_id[0]) return (dotlottie_reset_theme(p->core) == DOTLOTTIE_SUCCESS);
-    return (dotlottie_set_theme(p->core, theme_id) == DOTLOTTIE_SUCCESS);
+    unsigned char block[64];
+    for (int by = 0; by < h; by += 4) {
+        for (int bx = 0; bx < w; bx += 4) {
+            for (int y = 0; y < 4; ++y) {
+                int sy = (by + y < h) ? by + y : h - 1;
+                for (int x = 0; x < 4; ++x) {
+                    int sx = (bx + x < w) ? bx + x : w - 1;
+                    memcpy(block + (y * 4 + x) * 4, rgba + ((size_t)sy * (size_t)w + (size_t)sx) * 4u, 4);
+                }
+            }
+            if (format == DLRL_BAKE_DXT5) {
+                encode_alpha_block(block, out);
+                encode_color_block(block, false, out + 8);
+                out += 16;
+            } else {
+                encode_color_block(block, true, out);
+                out += 8;
+            }
+        }
+    }
 }
 
-bool dlrl_SetAnimation(dlrl_Player* p, const char* animation_id)
+static int raylib_format(dlrl_BakeFormat format)
 {
-    if (!p || !animation_id) return false;
-    uint32_t loadW = p->requestedW ? p->requestedW : DLRL_FALLBACK_SURFACE;
-    uint32_t loadH = p->requestedH ? p->requestedH : DLRL_FALLBACK_SURFACE;
-    if (dotlottie_load_animation(p->core, animation_id, loadW, loadH) != DOTLOTTIE_SUCCESS) {
-        return false;
+    switch (format) {
+        case DLRL_BAKE_DXT1: return PIXELFORMAT_COMPRESSED_DXT1_RGBA;
+        case DLRL_BAKE_DXT5: return PIXELFORMAT_COMPRESSED_DXT5_RGBA;
+        case DLRL_BAKE_RGBA8: break;
     }
-    float naturalW = 0.f, naturalH = 0.f, duration = 0.f, totalFrames = 0.f;
-    dotlottie_animation_size(p->core, &naturalW, &naturalH);
-    dotlottie_duration(p->core, &duration);
-    dotlottie_total_frames(p->core, &totalFrames);
+    return PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+}
 
-    uint32_t targetW = p->requestedW ? p->requestedW : (naturalW > 0.f ? (uint32_t)naturalW : loadW);
-    uint32_t targetH = p->requestedH ? p->requestedH : (naturalH > 0.f ? (uint32_t)naturalH : loadH);
+static void free_bake_sheets(dlrl_Player* p)
+{
+    dlrl_Bake* b = &p->bake;
+    for (int i = 0; i < b->sheetCount; ++i) UnloadTexture(b->sheets[i]);
+    b->sheetCount = 0;
+    b->bytes = 0;
+}
 
-    if ((targetW != loadW || targetH != loadH) &&
-            dotlottie_resize(p->core, targetW, targetH) != DOTLOTTIE_SUCCESS) {
-        return false;
+/* Upload one sheet, compressed when requested; falls back to RGBA8 if the GPU lacks DXT. */
+static bool upload_sheet(dlrl_Bake* b, const unsigned char* rgba, int w, int h, unsigned char* scratch)
+{
+    Texture2D t = {0};
+    size_t bytes = dlrl_CompressedSize(w, h, b->format);
+    if (b->format != DLRL_BAKE_RGBA8) {
+        compress_blocks(rgba, w, h, b->format, scratch);
+        Image img = { .data = scratch, .width = w, .height = h, .mipmaps = 1, .format = raylib_format(b->format) };
+        t = LoadTextureFromImage(img);
+        b->actual = b->format;
     }
-    if (!recreate_texture(p, targetW, targetH)) {
-        return false;
+    if (t.id == 0) {
+        Image img = { .data = (void*)rgba, .width = w, .height = h, .mipmaps = 1,
+                      .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+        t = LoadTextureFromImage(img);
+        bytes = surface_bytes(w, h);
+        b->actual = DLRL_BAKE_RGBA8;
     }
+    if (t.id == 0) return false;
+    b->sheets[b->sheetCount++] = t;
+    b->bytes += bytes;
+    return true;
+}
 
-    p->assetDuration = duration;
-    p->duration = duration;
-    p->totalFrames = totalFrames > 0.f ? (int)totalFrames : 1;
-    p->segmentStartFrame = 0.f;
-    p->segmentFrameCount = (float)p->totalFrames;
-    p->time = 0.f;
-    p->natural = (Vector2){naturalW, naturalH};
-    if (p->markers) {
-        MemFree(p->markers);
-        p->markers = NULL;
+/* Rasterize every frame of the baked segment into grid sheets of padded cells. */
+static bool build_bake(dlrl_Player* p)
+{
+    dlrl_Bake* b = &p->bake;
+    free_bake_sheets(p);
+    if (b->marker != DLRL_NO_MARKER && b->marker >= p->markerCount) return false;
+    b->startFrame = (b->marker == DLRL_NO_MARKER) ? 0.f : p->markers[b->marker].startFrame;
+    b->frameCount = (b->marker == DLRL_NO_MARKER) ? p->totalFrames : (int)p->markers[b->marker].frameCount;
+    if (b->frameCount < 1) b->frameCount = 1;
+    b->cellW = (p->texW + 3) & ~3;
+    b->cellH = (p->texH + 3) & ~3;
+    if (b->cellW > DLRL_BAKE_MAX_SHEET || b->cellH > DLRL_BAKE_MAX_SHEET) return false;
+    b->cols = DLRL_BAKE_MAX_SHEET / b->cellW;
+    b->perSheet = b->cols * (DLRL_BAKE_MAX_SHEET / b->cellH);
+    int sheets = (b->frameCount + b->perSheet - 1) / b->perSheet;
+    if (sheets > DLRL_BAKE_MAX_SHEETS) return false;
+
+    int firstFrames = (b->frameCount < b->perSheet) ? b->frameCount : b->perSheet;
+    int maxW = ((firstFrames < b->cols) ? firstFrames : b->cols) * b->cellW;
+    int maxH = ((firstFrames + b->cols - 1) / b->cols) * b->cellH;
+    size_t sheetBytes = surface_bytes(maxW, maxH);
+    unsigned char* sheet = (unsigned char*)MemAlloc((unsigned int)sheetBytes);
+    unsigned char* scratch = (b->format != DLRL_BAKE_RGBA8)
+        ? (unsigned char*)MemAlloc((unsigned int)dlrl_CompressedSize(maxW, maxH, b->format)) : NULL;
+    bool ok = sheet && (b->format == DLRL_BAKE_RGBA8 || scratch);
+
+    size_t rowBytes = (size_t)p->texW * 4u;
+    for (int s = 0; ok && s < sheets; ++s) {
+        int first = s * b->perSheet;
+        int frames = (b->frameCount - first < b->perSheet) ? b->frameCount - first : b->perSheet;
+        int w = ((frames < b->cols) ? frames : b->cols) * b->cellW;
+        int h = ((frames + b->cols - 1) / b->cols) * b->cellH;
+        memset(sheet, 0, surface_bytes(w, h));
+        for (int k = 0; k < frames; ++k) {
+            const uint32_t* ptr = NULL;
+            dotlottie_set_frame(p->core, b->startFrame + (float)(first + k));
+            dotlottie_render(p->core);
+            dotlottie_buffer_ptr(p->core, &ptr);
+            if (!ptr) { ok = false; break; }
+            int ox = (k % b->cols) * b->cellW;
+            int oy = (k / b->cols) * b->cellH;
+            for (int y = 0; y < p->texH; ++y) {
+                memcpy(sheet + ((size_t)(oy + y) * (size_t)w + (size_t)ox) * 4u,
+                       (const unsigned char*)ptr + (size_t)y * rowBytes, rowBytes);
+            }
+        }
+        if (ok) ok = upload_sheet(b, sheet, w, h, scratch);
     }
-    p->markerCount = 0;
-    p->activeMarker = -1;
-    load_markers(p);
-    return true;
+    if (sheet) MemFree(sheet);
+    if (scratch) MemFree(scratch);
+    if (!ok) free_bake_sheets(p);
+    b->frame = 0;
+    return ok;
 }
 
-bool dlrl_SetMarker(dlrl_Player* p, const char* marker_name)
+static bool bake_covers(const dlrl_Player* p)
 {
-    if (!p) return false;
-    if (!marker_name || !marker_name[0]) {
-        apply_segment(p, 0.f, (float)p->totalFrames, p->assetDuration);
-        p->activeMarker = -1;
-        return true;
+    return p->bake.sheetCount > 0 && p->bake.marker == p->activeMarker;
+}
+
+/* Texture and source rect holding the frame dlrl_Draw should show. */
+static void current_source(const dlrl_Player* p, Texture2D* tex, Rectangle* src)
+{
+    if (bake_covers(p)) {
+        const dlrl_Bake* b = &p->bake;
+        int sheet = b->frame / b->perSheet;
+        int k = b->frame % b->perSheet;
+        *tex = b->sheets[sheet];
+        *src = (Rectangle){ (float)((k % b->cols) * b->cellW), (float)((k / b->cols) * b->cellH),
+                            (float)p->texW, (float)p->texH };
+        return;
     }
-    if (!p->markers || p->markerCount == 0) return false;
-    for (int i = 0; i < p->markerCount; ++i) {
-        if (equals_ignore_case(p->markers[i].name, marker_name)) {
-            apply_segment(p, p->markers[i].startFrame, p->markers[i].frameCount,
-                          p->markers[i].durationSeconds);
-            p->activeMarker = i;
-            return true;
+    *tex = p->tex;
+    *src = (Rectangle){ 0, 0, (float)p->texW, (float)p->texH };
+}
+
+/* Run-length code over 32-bit pixels: a word with the top bit set is a run (count, pixel),
+ * otherwise a literal count followed by that many pixels. Returns words written. */
+static size_t rle_encode(const uint32_t* src, size_t n, uint32_t* out)
+{
+    size_t o = 0, i = 0;
+    while (i < n) {
+        size_t run = 1;
+        while (i + run < n && src[i + run] == src[i]) ++run;
+        if (run >= 3) {
+            out[o++] = 0x80000000u | (uint32_t)run;
+            out[o++] = src[i];
+            i += run;
+            continue;
         }
+        size_t start = i;
+        while (i < n && !(i + 2 < n && src[i] == src[i + 1] && src[i] == src[i + 2])) ++i;
+        out[o++] = (uint32_t)(i - start);
+        memcpy(out + o, src + start, (i - start) * 4u);
+        o += i - start;
     }
-    return false;
+    return o;
 }
 
-int dlrl_MarkerCount(const dlrl_Player* p)
+static bool rle_decode(const uint32_t* in, size_t words, uint32_t* dst, size_t n)
 {
-    return p ? p->markerCount : 0;
+    size_t i = 0, o = 0;
+    while (i < words) {
+        uint32_t h = in[i++];
+        size_t count = h & 0x7FFFFFFFu;
+        if (o + count > n) return false;
+        if (h & 0x80000000u) {
+            if (i >= words) return false;
+            uint32_t v = in[i++];
+            for (size_t k = 0; k < count; ++k) dst[o++] = v;
+        } else {
+            if (i + count > words) return false;
+            memcpy(dst + o, in + i, count * 4u);
+            i += count;
+            o += count;
+        }
+    }
+    return o == n;
 }
 
-const char* dlrl_MarkerName(const dlrl_Player* p, int index)
+/* Read-only view of a whole file: mmap where available, a heap copy otherwise. */
+static bool map_file(const char* path, const unsigned char** outData, size_t* outSize)
 {
-    if (!p || index < 0 || index >= p->markerCount || !p->markers) return NULL;
-    return p->markers[index].name;
+#if defined(_WIN32)
+    unsigned char* blob = NULL;
+    if (!read_binary_file(path, &blob, outSize)) return false;
+    *outData = blob;
+    return true;
+#else
+    const unsigned char* data = NULL;
+    size_t size = 0;
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        size = (size_t)st.st_size;
+        void* m = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        data = (m == MAP_FAILED) ? NULL : (const unsigned char*)m;
+    }
+    close(fd);
+    if (!data) return false;
+    *outData = data;
+    *outSize = size;
+    return true;
+#endif
+}
+
+static void unmap_file(const unsigned char* data, size_t size)
+{
+    if (!data) return;
+#if defined(_WIN32)
+    (void)size;
+    MemFree((void*)data);
+#else
+    munmap((void*)data, size);
+#endif
+}
+
+/* Move a finished temp file over path. POSIX rename replaces atomically, so a crash leaves
+ * either the old file or the new one. Windows rename refuses an existing target; windows.h
+ * clashes with raylib.h, so remove the old file first there and accept the short gap. */
+static bool replace_file(const char* tmp, const char* path)
+{
+#if defined(_WIN32)
+    remove(path);
+#endif
+    return rename(tmp, path) == 0;
+}
+
+/* ---- Font registry ---- */
+
+enum { DLRL_FONT_QUEUED, DLRL_FONT_LOADING, DLRL_FONT_LOADED, DLRL_FONT_READY, DLRL_FONT_FAILED };
+
+/* One copy of font bytes, shared by every name registered with the same content. */
+typedef struct {
+    uint64_t hash;
+    const unsigned char* data;
+    size_t size;
+    bool mapped;            /* map_file view rather than a MemAlloc copy */
+} dlrl_FontBlob;
+
+typedef struct {
+    char name[DLRL_MAX_FONT_NAME];
+    char* path;             /* file fonts; kept to skip re-registering the same file */
+    int blob;               /* index into blobs, -1 until loaded */
+    int state;              /* DLRL_FONT_* */
+} dlrl_FontEntry;
+
+static struct {
+    dlrl_FontEntry* fonts;
+    int count, cap;
+    dlrl_FontBlob* blobs;
+    int blobCount, blobCap;
+    int pending;            /* entries queued for or held by the loader thread */
+#if defined(DLRL_HAVE_PTHREADS)
+    pthread_t thread;
+    bool threadRunning;
+    bool stop;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+#endif
+} g_fonts = {
+#if defined(DLRL_HAVE_PTHREADS)
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .cond = PTHREAD_COND_INITIALIZER
+#else
+    .count = 0
+#endif
+};
+
+static void lock_fonts(void)
+{
+#if defined(DLRL_HAVE_PTHREADS)
+    pthread_mutex_lock(&g_fonts.lock);
+#endif
+}
+
+static void unlock_fonts(void)
+{
+#if defined(DLRL_HAVE_PTHREADS)
+    pthread_mutex_unlock(&g_fonts.lock);
+#endif
+}
+
+static int find_font(const char* name)
+{
+    for (int i = 0; i < g_fonts.count; ++i) {
+        if (strcmp(g_fonts.fonts[i].name, name) == 0) return i;
+    }
+    return -1;
+}
+
+static int add_font(const char* name)
+{
+    if (g_fonts.count == g_fonts.cap) {
+        int cap = g_fonts.cap ? g_fonts.cap * 2 : 8;
+        dlrl_FontEntry* grown = (dlrl_FontEntry*)MemRealloc(g_fonts.fonts, (unsigned int)(sizeof(dlrl_FontEntry) * (size_t)cap));
+        if (!grown) return -1;
+        g_fonts.fonts = grown;
+        g_fonts.cap = cap;
+    }
+    dlrl_FontEntry* e = &g_fonts.fonts[g_fonts.count];
+    *e = (dlrl_FontEntry){ .blob = -1 };
+    copy_capped(e->name, sizeof(e->name), name);
+    return g_fonts.count++;
+}
+
+/* Adopt data as a blob unless identical bytes are already held; the duplicate is released. */
+static int share_blob(const unsigned char* data, size_t size, bool mapped, uint64_t hash)
+{
+    for (int i = 0; i < g_fonts.blobCount; ++i) {
+        const dlrl_FontBlob* b = &g_fonts.blobs[i];
+        if (b->hash != hash || b->size != size || memcmp(b->data, data, size) != 0) continue;
+        if (mapped) unmap_file(data, size);
+        else MemFree((void*)data);
+        return i;
+    }
+    if (g_fonts.blobCount == g_fonts.blobCap) {
+        int cap = g_fonts.blobCap ? g_fonts.blobCap * 2 : 8;
+        dlrl_FontBlob* grown = (dlrl_FontBlob*)MemRealloc(g_fonts.blobs, (unsigned int)(sizeof(dlrl_FontBlob) * (size_t)cap));
+        if (!grown) return -1;
+        g_fonts.blobs = grown;
+        g_fonts.blobCap = cap;
+    }
+    g_fonts.blobs[g_fonts.blobCount] = (dlrl_FontBlob){ .hash = hash, .data = data, .size = size, .mapped = mapped };
+    return g_fonts.blobCount++;
+}
+
+/* Hand loaded fonts to the runtime; with wait, first let the loader thread drain. Main thread only. */
+static void settle_fonts(bool wait)
+{
+    lock_fonts();
+#if defined(DLRL_HAVE_PTHREADS)
+    while (wait && g_fonts.pending > 0) pthread_cond_wait(&g_fonts.cond, &g_fonts.lock);
+#else
+    (void)wait;
+#endif
+    for (int i = 0; i < g_fonts.count; ++i) {
+        dlrl_FontEntry* e = &g_fonts.fonts[i];
+        if (e->state != DLRL_FONT_LOADED) continue;
+        const dlrl_FontBlob* b = &g_fonts.blobs[e->blob];
+        bool ok = dotlottie_register_font(e->name, (const char*)b->data, b->size) == DOTLOTTIE_SUCCESS;
+        e->state = ok ? DLRL_FONT_READY : DLRL_FONT_FAILED;
+        if (!ok) TraceLog(LOG_WARNING, "DLRL: font '%s' was rejected by the runtime", e->name);
+    }
+    unlock_fonts();
+}
+
+/* Map (or read) a font file and fold it into the blob list; called without the lock held. */
+static int load_font_file(const char* path)
+{
+    const unsigned char* data = NULL;
+    size_t size = 0;
+    if (!map_file(path, &data, &size)) return -1;
+    uint64_t hash = hash64(14695981039346656037ull, data, size);
+    lock_fonts();
+    int blob = share_blob(data, size, true, hash);
+    unlock_fonts();
+    return blob;
+}
+
+#if defined(DLRL_HAVE_PTHREADS)
+/* Reads, maps and hashes queued font files so loads only pay for the runtime registration. */
+static void* font_loader(void* arg)
+{
+    (void)arg;
+    pthread_mutex_lock(&g_fonts.lock);
+    for (;;) {
+        if (g_fonts.stop) {
+            /* Shutdown drops whatever is still queued instead of reading it first. */
+            for (int i = 0; i < g_fonts.count; ++i) {
+                if (g_fonts.fonts[i].state != DLRL_FONT_QUEUED) continue;
+                g_fonts.fonts[i].state = DLRL_FONT_FAILED;
+                g_fonts.pending--;
+            }
+            pthread_cond_broadcast(&g_fonts.cond);
+            break;
+        }
+        int next = -1;
+        for (int i = 0; i < g_fonts.count && next < 0; ++i) {
+            if (g_fonts.fonts[i].state == DLRL_FONT_QUEUED) next = i;
+        }
+        if (next < 0) {
+            pthread_cond_wait(&g_fonts.cond, &g_fonts.lock);
+            continue;
+        }
+        g_fonts.fonts[next].state = DLRL_FONT_LOADING;
+        const char* path = g_fonts.fonts[next].path;
+        pthread_mutex_unlock(&g_fonts.lock);
+
+        int blob = load_font_file(path);
+
+        pthread_mutex_lock(&g_fonts.lock);
+        dlrl_FontEntry* e = &g_fonts.fonts[next];
+        e->blob = blob;
+        e->state = (blob >= 0) ? DLRL_FONT_LOADED : DLRL_FONT_FAILED;
+        if (blob < 0) TraceLog(LOG_WARNING, "DLRL: failed to read font file %s", path);
+        g_fonts.pending--;
+        pthread_cond_broadcast(&g_fonts.cond);
+    }
+    pthread_mutex_unlock(&g_fonts.lock);
+    return NULL;
+}
+#endif
+
+/* Wait for an entry the loader thread still owns before replacing it. */
+static void settle_font_name(const char* name)
+{
+    lock_fonts();
+    int i = find_font(name);
+    bool busy = i >= 0 && (g_fonts.fonts[i].state == DLRL_FONT_QUEUED || g_fonts.fonts[i].state == DLRL_FONT_LOADING);
+    unlock_fonts();
+    if (busy) settle_fonts(true);
+}
+
+static void clear_fonts(void)
+{
+#if defined(DLRL_HAVE_PTHREADS)
+    pthread_mutex_lock(&g_fonts.lock);
+    g_fonts.stop = true;
+    pthread_cond_broadcast(&g_fonts.cond);
+    pthread_mutex_unlock(&g_fonts.lock);
+    if (g_fonts.threadRunning) pthread_join(g_fonts.thread, NULL);
+    g_fonts.threadRunning = false;
+    g_fonts.stop = false;
+#endif
+    for (int i = 0; i < g_fonts.count; ++i) {
+        if (g_fonts.fonts[i].path) MemFree(g_fonts.fonts[i].path);
+    }
+    for (int i = 0; i < g_fonts.blobCount; ++i) {
+        const dlrl_FontBlob* b = &g_fonts.blobs[i];
+        if (b->mapped) unmap_file(b->data, b->size);
+        else MemFree((void*)b->data);
+    }
+    if (g_fonts.fonts) MemFree(g_fonts.fonts);
+    if (g_fonts.blobs) MemFree(g_fonts.blobs);
+    g_fonts.fonts = NULL;
+    g_fonts.blobs = NULL;
+    g_fonts.count = g_fonts.cap = 0;
+    g_fonts.blobCount = g_fonts.blobCap = 0;
+    g_fonts.pending = 0;
+}
+
+static void cache_unmap(dlrl_FrameCache* c)
+{
+    if (!c->map) return;
+    unmap_file(c->map, c->mapSize);
+    c->map = NULL;
+    c->mapSize = 0;
+    c->entries = NULL;
+}
+
+/* Map the cache file and accept it only if its header, key and index are consistent. */
+static void cache_map(dlrl_FrameCache* c)
+{
+    const unsigned char* data = NULL;
+    size_t size = 0;
+    if (!map_file(c->path, &data, &size)) return;
+    c->map = data;
+    c->mapSize = size;
+
+    const dlrl_CacheHeader* hdr = (const dlrl_CacheHeader*)data;
+    size_t indexEnd = sizeof(dlrl_CacheHeader) + sizeof(dlrl_CacheEntry) * (size_t)c->frameCount;
+    bool ok = size >= indexEnd &&
+        hdr->magic == DLRL_CACHE_MAGIC && hdr->version == DLRL_CACHE_VERSION &&
+        hdr->assetHash == c->assetHash && hdr->keyHash == c->keyHash &&
+        hdr->width == (uint32_t)c->w && hdr->height == (uint32_t)c->h &&
+        hdr->frameCount == (uint32_t)c->frameCount;
+    const dlrl_CacheEntry* entries = (const dlrl_CacheEntry*)(data + sizeof(dlrl_CacheHeader));
+    for (int f = 0; ok && f < c->frameCount; ++f) {
+        const dlrl_CacheEntry* e = &entries[f];
+        if (e->kind == DLRL_CACHE_MISSING) continue;
+        ok = e->kind <= DLRL_CACHE_DELTA && (e->offset % 4u) == 0 && (e->size % 4u) == 0 &&
+             e->offset >= indexEnd && (size_t)e->offset + e->size <= size &&
+             (e->kind != DLRL_CACHE_DELTA || (f % DLRL_CACHE_KEYFRAME_INTERVAL) != 0);
+    }
+    if (!ok) {
+        cache_unmap(c);
+        return;
+    }
+    c->entries = entries;
+}
+
+static bool cache_lookup(const dlrl_FrameCache* c, int f, const uint32_t** words, size_t* count, uint32_t* kind)
+{
+    if (c->pending[f].kind != DLRL_CACHE_MISSING) {
+        *words = c->pending[f].data;
+        *count = c->pending[f].words;
+        *kind = c->pending[f].kind;
+        return true;
+    }
+    if (!c->entries || c->entries[f].kind == DLRL_CACHE_MISSING) return false;
+    *words = (const uint32_t*)(c->map + c->entries[f].offset);
+    *count = c->entries[f].size / 4u;
+    *kind = c->entries[f].kind;
+    return true;
+}
+
+/* Decode frame f into c->frame; delta frames first bring back their predecessor. */
+static bool cache_decode(dlrl_FrameCache* c, int f)
+{
+    if (c->frameIndex == f) return true;
+    const uint32_t* words = NULL;
+    size_t count = 0;
+    uint32_t kind = DLRL_CACHE_MISSING;
+    if (!cache_lookup(c, f, &words, &count, &kind)) return false;
+    size_t n = (size_t)c->w * (size_t)c->h;
+    if (kind == DLRL_CACHE_DELTA) {
+        if (c->frameIndex != f - 1 && !cache_decode(c, f - 1)) return false;
+        if (!rle_decode(words, count, c->scratch, n)) return false;
+        for (size_t i = 0; i < n; ++i) c->frame[i] ^= c->scratch[i];
+    } else {
+        c->frameIndex = -1;
+        if (!rle_decode(words, count, c->frame, n)) return false;
+    }
+    c->frameIndex = f;
+    return true;
+}
+
+/* Encode a freshly rendered frame, as a delta when its predecessor is at hand and that is smaller. */
+static void cache_store(dlrl_FrameCache* c, int f, const uint32_t* pixels)
+{
+    size_t n = (size_t)c->w * (size_t)c->h;
+    uint32_t* intra = c->scratch;
+    size_t words = rle_encode(pixels, n, intra);
+    const uint32_t* best = intra;
+    uint32_t kind = DLRL_CACHE_INTRA;
+    if (f % DLRL_CACHE_KEYFRAME_INTERVAL != 0 && c->frameIndex == f - 1) {
+        uint32_t* delta = c->scratch + n + 16;
+        for (size_t i = 0; i < n; ++i) c->frame[i] ^= pixels[i];
+        size_t deltaWords = rle_encode(c->frame, n, delta);
+        if (deltaWords < words) {
+            best = delta;
+            words = deltaWords;
+            kind = DLRL_CACHE_DELTA;
+        }
+    }
+    memcpy(c->frame, pixels, n * 4u);
+    c->frameIndex = f;
+
+    uint32_t* copy = (uint32_t*)MemAlloc((unsigned int)(words * 4u));
+    if (!copy) return;
+    memcpy(copy, best, words * 4u);
+    c->pending[f] = (dlrl_CacheBlob){ .data = copy, .words = words, .kind = kind };
+    c->pendingCount++;
+}
+
+/* Keep the cache directory under cache_max_bytes by deleting the least recently written files. */
+static void cache_trim(const char* keep)
+{
+    if (g_dlrl.opts.cache_max_bytes == 0) return;
+    FilePathList files = LoadDirectoryFilesEx(g_dlrl.cacheDir, ".dlfc", false);
+    size_t total = 0;
+    for (unsigned int i = 0; i < files.count; ++i) total += (size_t)GetFileLength(files.paths[i]);
+    while (total > g_dlrl.opts.cache_max_bytes) {
+        int oldest = -1;
+        long oldestTime = 0;
+        for (unsigned int i = 0; i < files.count; ++i) {
+            if (!files.paths[i][0] || strcmp(files.paths[i], keep) == 0) continue;
+            long t = GetFileModTime(files.paths[i]);
+            if (oldest < 0 || t < oldestTime) { oldest = (int)i; oldestTime = t; }
+        }
+        if (oldest < 0) break;
+        total -= (size_t)GetFileLength(files.paths[oldest]);
+        remove(files.paths[oldest]);
+        files.paths[oldest][0] = '\0';
+    }
+    UnloadDirectoryFiles(files);
+}
+
+/* Rewrite the cache file with mapped and pending frames, then map the result. */
+static bool cache_flush(dlrl_FrameCache* c)
+{
+    if (c->pendingCount == 0) return true;
+    size_t offset = sizeof(dlrl_CacheHeader) + sizeof(dlrl_CacheEntry) * (size_t)c->frameCount;
+    dlrl_CacheEntry* entries = (dlrl_CacheEntry*)MemAlloc((unsigned int)(sizeof(dlrl_CacheEntry) * (size_t)c->frameCount));
+    if (!entries) return false;
+    for (int f = 0; f < c->frameCount; ++f) {
+        const uint32_t* words = NULL;
+        size_t count = 0;
+        uint32_t kind = DLRL_CACHE_MISSING;
+        entries[f] = (dlrl_CacheEntry){0};
+        if (!cache_lookup(c, f, &words, &count, &kind)) continue;
+        entries[f] = (dlrl_CacheEntry){ .offset = (uint32_t)offset, .size = (uint32_t)(count * 4u), .kind = kind };
+        offset += count * 4u;
+    }
+
+    char tmp[sizeof(c->path) + 8];
+    snprintf(tmp, sizeof(tmp), "%s.tmp", c->path);
+    FILE* out = (offset <= 0xFFFFFFFFu) ? fopen(tmp, "wb") : NULL;
+    bool ok = (out != NULL);
+    if (ok) {
+        dlrl_CacheHeader hdr = {
+            .magic = DLRL_CACHE_MAGIC, .version = DLRL_CACHE_VERSION,
+            .assetHash = c->assetHash, .keyHash = c->keyHash,
+            .width = (uint32_t)c->w, .height = (uint32_t)c->h, .frameCount = (uint32_t)c->frameCount
+        };
+        ok = fwrite(&hdr, sizeof(hdr), 1, out) == 1 &&
+             fwrite(entries, sizeof(dlrl_CacheEntry), (size_t)c->frameCount, out) == (size_t)c->frameCount;
+        for (int f = 0; ok && f < c->frameCount; ++f) {
+            const uint32_t* words = NULL;
+            size_t count = 0;
+            uint32_t kind = DLRL_CACHE_MISSING;
+            if (cache_lookup(c, f, &words, &count, &kind)) ok = fwrite(words, 4u, count, out) == count;
+        }
+        ok = (fclose(out) == 0) && ok;
+    }
+    MemFree(entries);
+
+    cache_unmap(c);
+    for (int f = 0; f < c->frameCount; ++f) {
+        if (c->pending[f].data) MemFree(c->pending[f].data);
+        c->pending[f] = (dlrl_CacheBlob){0};
+    }
+    c->pendingCount = 0;
+    c->frameIndex = -1;
+    if (ok) ok = replace_file(tmp, c->path);
+    if (!ok) remove(tmp);
+    cache_map(c);
+    if (ok) cache_trim(c->path);
+    return ok;
+}
+
+static void cache_close(dlrl_Player* p)
+{
+    dlrl_FrameCache* c = &p->cache;
+    if (!c->pending) return;
+    cache_flush(c);
+    cache_unmap(c);
+    MemFree(c->pending);
+    if (c->frame) MemFree(c->frame);
+    if (c->scratch) MemFree(c->scratch);
+    c->pending = NULL;
+    c->frame = NULL;
+    c->scratch = NULL;
+}
+
+/* (Re)key the cache for the active animation, theme, background and size, and map any existing file. */
+static void cache_open(dlrl_Player* p)
+{
+    dlrl_FrameCache* c = &p->cache;
+    cache_close(p);
+    if (!c->enabled || !g_dlrl.cacheDir[0] || p->evicted) return;
+
+    if (!c->assetHashed) {
+        uint64_t h = 14695981039346656037ull;
+        if (p->sourceKind == DLRL_SOURCE_PATH) {
+            unsigned char* data = NULL;
+            size_t size = 0;
+            if (!read_binary_file((const char*)p->source, &data, &size)) return;
+            h = hash64(h, data, size);
+            MemFree(data);
+        } else {
+            h = hash64(h, p->source, p->sourceSize);
+        }
+        c->assetHash = h;
+        c->assetHashed = true;
+    }
+    char animationId[DOTLOTTIE_MAX_STR_LENGTH] = {0};
+    dotlottie_active_animation_id(p->core, animationId);
+    uint64_t k = hash64(14695981039346656037ull, animationId, strlen(animationId) + 1);
+    uint64_t themeKey = theme_hash(p->theme);
+    k = hash64(k, &themeKey, sizeof(themeKey));
+    /* The core fills every buffer with the background before drawing. */
+    unsigned char bg[4] = { p->bg.r, p->bg.g, p->bg.b, p->bg.a };
+    k = hash64(k, bg, sizeof(bg));
+    c->keyHash = k;
+    c->w = p->texW;
+    c->h = p->texH;
+    c->frameCount = p->totalFrames;
+
+    uint64_t name = hash64(c->assetHash ^ c->keyHash, &c->w, sizeof(c->w));
+    name = hash64(name, &c->h, sizeof(c->h));
+    snprintf(c->path, sizeof(c->path), "%s/%016llx.dlfc", g_dlrl.cacheDir, (unsigned long long)name);
+
+    size_t n = (size_t)c->w * (size_t)c->h;
+    c->pending = (dlrl_CacheBlob*)MemAlloc((unsigned int)(sizeof(dlrl_CacheBlob) * (size_t)c->frameCount));
+    c->frame = (uint32_t*)MemAlloc((unsigned int)(n * 4u));
+    c->scratch = (uint32_t*)MemAlloc((unsigned int)((n + 16) * 2u * 4u));
+    if (!c->pending || !c->frame || !c->scratch) {
+        if (c->pending) memset(c->pending, 0, sizeof(dlrl_CacheBlob) * (size_t)c->frameCount);
+        cache_close(p);
+        return;
+    }
+    memset(c->pending, 0, sizeof(dlrl_CacheBlob) * (size_t)c->frameCount);
+    c->pendingCount = 0;
+    c->frameIndex = -1;
+    cache_map(c);
+}
+
+/* Serve frame f from the cache, or render it and queue it for the next flush. */
+static const uint32_t* cache_present(dlrl_Player* p, float targetFrame)
+{
+    dlrl_FrameCache* c = &p->cache;
+    int f = (int)(targetFrame + 0.5f);
+    if (f < 0) f = 0;
+    if (f >= c->frameCount) f = c->frameCount - 1;
+    if (cache_decode(c, f)) {
+        c->hits++;
+        return c->frame;
+    }
+    c->misses++;
+    const uint32_t* ptr = NULL;
+    dotlottie_set_frame(p->core, (float)f);
+    dotlottie_render(p->core);
+    dotlottie_buffer_ptr(p->core, &ptr);
+    if (ptr) cache_store(c, f, ptr);
+    return ptr;
+}
+
+static void frames_invalidated(dlrl_Player* p)
+{
+    p->presentedFrame = -1.f;
+    p->contentSerial++;
+    p->framePixels = NULL;
+}
+
+static void content_changed(dlrl_Player* p)
+{
+    frames_invalidated(p);
+    cache_open(p);
+}
+
+/* Record the frame now on screen; the upload is skipped for players composited by a canvas. */
+static void present_frame(dlrl_Player* p, const uint32_t* pixels, float frame, bool upload)
+{
+    if (upload) upload_frame(p->tex, p->texW, p->texH, pixels);
+    if (frame != p->presentedFrame || pixels != p->framePixels) p->frameSerial++;
+    p->presentedFrame = frame;
+    p->framePixels = pixels;
+}
+
+/* Players merged into one CPU surface; see dlrl_UpdateCanvas. */
+typedef struct {
+    const dlrl_Player* player;
+    uint32_t serial;
+    int x0, y0, x1, y1;     /* fitted frame box, unclipped so off-canvas parts crop */
+    int bx0, by0, bx1, by1; /* background box (layer dest), clipped */
+    Color tint;
+} dlrl_CanvasSlot;
+
+struct dlrl_Canvas {
+    int w, h;
+    Texture2D tex;
+    uint32_t* surface;      /* premultiplied RGBA, w * h */
+    uint32_t* staging;      /* dirty box packed for the single upload */
+    uint32_t* row;          /* scaled source span */
+    dlrl_CanvasSlot* slots; /* layers composited last time */
+    int slotCount, slotCap;
+    bool fresh;             /* nothing composited yet: the whole surface is dirty */
+    Rectangle dirty;
+};
+
+static uint32_t mul_div255(uint32_t x, uint32_t y)
+{
+    uint32_t t = x * y + 128u;
+    return (t + (t >> 8)) >> 8;
+}
+
+/* Premultiplied over of n straight-alpha source pixels, tinted, onto dst. Reference for the SIMD paths. */
+static void blend_row_scalar(uint32_t* dst, const uint32_t* src, int n, Color tint)
+{
+    const unsigned char* s = (const unsigned char*)src;
+    unsigned char* d = (unsigned char*)dst;
+    for (int i = 0; i < n; ++i, s += 4, d += 4) {
+        uint32_t a = mul_div255(s[3], tint.a);
+        if (a == 0) continue;
+        uint32_t inv = 255u - a;
+        d[0] = (unsigned char)(mul_div255(mul_div255(s[0], tint.r), a) + mul_div255(d[0], inv));
+        d[1] = (unsigned char)(mul_div255(mul_div255(s[1], tint.g), a) + mul_div255(d[1], inv));
+        d[2] = (unsigned char)(mul_div255(mul_div255(s[2], tint.b), a) + mul_div255(d[2], inv));
+        d[3] = (unsigned char)(a + mul_div255(d[3], inv));
+    }
+}
+
+#if defined(DLRL_SIMD_SSE2)
+static __m128i div255_epi16(__m128i x)
+{
+    __m128i t = _mm_add_epi16(x, _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+}
+
+/* Two pixels in 16-bit lanes; same arithmetic as blend_row_scalar. */
+static __m128i blend_pair_sse2(__m128i s, __m128i d, __m128i tint)
+{
+    const __m128i alphaLanes = _mm_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0);
+    s = div255_epi16(_mm_mullo_epi16(s, tint));
+    __m128i a = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+    __m128i premul = _mm_or_si128(_mm_andnot_si128(alphaLanes, a), _mm_and_si128(alphaLanes, _mm_set1_epi16(255)));
+    s = div255_epi16(_mm_mullo_epi16(s, premul));
+    __m128i inv = _mm_sub_epi16(_mm_set1_epi16(255), a);
+    return _mm_add_epi16(s, div255_epi16(_mm_mullo_epi16(d, inv)));
+}
+
+static void blend_row(uint32_t* dst, const uint32_t* src, int n, Color tint)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i t = _mm_set_epi16(tint.a, tint.b, tint.g, tint.r, tint.a, tint.b, tint.g, tint.r);
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i s = _mm_loadu_si128((const __m128i*)(src + i));
+        __m128i d = _mm_loadu_si128((const __m128i*)(dst + i));
+        __m128i lo = blend_pair_sse2(_mm_unpacklo_epi8(s, zero), _mm_unpacklo_epi8(d, zero), t);
+        __m128i hi = blend_pair_sse2(_mm_unpackhi_epi8(s, zero), _mm_unpackhi_epi8(d, zero), t);
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(lo, hi));
+    }
+    blend_row_scalar(dst + i, src + i, n - i, tint);
+}
+#elif defined(DLRL_SIMD_NEON)
+static uint16x8_t div255_u16(uint16x8_t x)
+{
+    uint16x8_t t = vaddq_u16(x, vdupq_n_u16(128));
+    return vshrq_n_u16(vaddq_u16(t, vshrq_n_u16(t, 8)), 8);
+}
+
+/* Two pixels in 16-bit lanes; same arithmetic as blend_row_scalar. */
+static uint16x8_t blend_pair_neon(uint16x8_t s, uint16x8_t d, uint16x8_t tint)
+{
+    static const uint16_t alphaMask[8] = { 0, 0, 0, 0xFFFF, 0, 0, 0, 0xFFFF };
+    const uint16x8_t alphaLanes = vld1q_u16(alphaMask);
+    s = div255_u16(vmulq_u16(s, tint));
+    uint16x4_t aLo = vdup_lane_u16(vget_low_u16(s), 3);
+    uint16x4_t aHi = vdup_lane_u16(vget_high_u16(s), 3);
+    uint16x8_t a = vcombine_u16(aLo, aHi);
+    uint16x8_t premul = vbslq_u16(alphaLanes, vdupq_n_u16(255), a);
+    s = div255_u16(vmulq_u16(s, premul));
+    uint16x8_t inv = vsubq_u16(vdupq_n_u16(255), a);
+    return vaddq_u16(s, div255_u16(vmulq_u16(d, inv)));
+}
+
+static void blend_row(uint32_t* dst, const uint32_t* src, int n, Color tint)
+{
+    const uint16_t tl[8] = { tint.r, tint.g, tint.b, tint.a, tint.r, tint.g, tint.b, tint.a };
+    const uint16x8_t t = vld1q_u16(tl);
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        uint8x16_t s = vld1q_u8((const uint8_t*)(src + i));
+        uint8x16_t d = vld1q_u8((const uint8_t*)(dst + i));
+        uint16x8_t lo = blend_pair_neon(vmovl_u8(vget_low_u8(s)), vmovl_u8(vget_low_u8(d)), t);
+        uint16x8_t hi = blend_pair_neon(vmovl_u8(vget_high_u8(s)), vmovl_u8(vget_high_u8(d)), t);
+        vst1q_u8((uint8_t*)(dst + i), vcombine_u8(vqmovn_u16(lo), vqmovn_u16(hi)));
+    }
+    blend_row_scalar(dst + i, src + i, n - i, tint);
+}
+#else
+static void blend_row(uint32_t* dst, const uint32_t* src, int n, Color tint)
+{
+    blend_row_scalar(dst, src, n, tint);
+}
+#endif
+
+static bool canvas_visible(const dlrl_Player* p)
+{
+    return p && !p->evicted && !bake_covers(p) && p->framePixels;
+}
+
+/* Place a layer: frame box from the player's fit/align inside dest, background box from dest. */
+static void canvas_place(const dlrl_Canvas* c, const dlrl_CanvasLayer* layer, dlrl_CanvasSlot* slot)
+{
+    const dlrl_Player* p = layer->player;
+    *slot = (dlrl_CanvasSlot){ .player = p, .tint = layer->tint };
+    if (!canvas_visible(p)) return;
+    slot->serial = p->frameSerial;
+
+    Rectangle fit = {0};
+    fit_rect(p->texW, p->texH, layer->dest, p->fit, p->align, &fit);
+    slot->x0 = (int)floorf(fit.x + 0.5f);
+    slot->y0 = (int)floorf(fit.y + 0.5f);
+    slot->x1 = (int)floorf(fit.x + fit.width + 0.5f);
+    slot->y1 = (int)floorf(fit.y + fit.height + 0.5f);
+    if (p->bg.a > 0) {
+        slot->bx0 = (int)floorf(layer->dest.x + 0.5f);
+        slot->by0 = (int)floorf(layer->dest.y + 0.5f);
+        slot->bx1 = (int)floorf(layer->dest.x + layer->dest.width + 0.5f);
+        slot->by1 = (int)floorf(layer->dest.y + layer->dest.height + 0.5f);
+    }
+    int* edges[4] = { &slot->bx0, &slot->bx1, &slot->by0, &slot->by1 };
+    for (int i = 0; i < 4; ++i) {
+        int limit = (i < 2) ? c->w : c->h;
+        if (*edges[i] < 0) *edges[i] = 0;
+        if (*edges[i] > limit) *edges[i] = limit;
+    }
+}
+
+static bool slots_equal(const dlrl_CanvasSlot* a, const dlrl_CanvasSlot* b)
+{
+    return a->player == b->player && a->serial == b->serial &&
+           a->x0 == b->x0 && a->y0 == b->y0 && a->x1 == b->x1 && a->y1 == b->y1 &&
+           a->bx0 == b->bx0 && a->by0 == b->by0 && a->bx1 == b->bx1 && a->by1 == b->by1 &&
+           a->tint.r == b->tint.r && a->tint.g == b->tint.g && a->tint.b == b->tint.b && a->tint.a == b->tint.a;
+}
+
+static void grow_box(int box[4], int x0, int y0, int x1, int y1)
+{
+    if (x0 >= x1 || y0 >= y1) return;
+    if (box[0] >= box[2] || box[1] >= box[3]) {
+        box[0] = x0; box[1] = y0; box[2] = x1; box[3] = y1;
+        return;
+    }
+    if (x0 < box[0]) box[0] = x0;
+    if (y0 < box[1]) box[1] = y0;
+    if (x1 > box[2]) box[2] = x1;
+    if (y1 > box[3]) box[3] = y1;
+}
+
+static void grow_box_slot(const dlrl_Canvas* c, int box[4], const dlrl_CanvasSlot* s)
+{
+    grow_box(box, s->x0 > 0 ? s->x0 : 0, s->y0 > 0 ? s->y0 : 0,
+             s->x1 < c->w ? s->x1 : c->w, s->y1 < c->h ? s->y1 : c->h);
+    grow_box(box, s->bx0, s->by0, s->bx1, s->by1);
+}
+
+/* Composite one layer into the surface, limited to the dirty box; sampling uses the unclipped frame box. */
+static void canvas_blend_layer(dlrl_Canvas* c, const dlrl_CanvasSlot* s, const int box[4])
+{
+    const dlrl_Player* p = s->player;
+    if (p->bg.a > 0) {
+        int x0 = s->bx0 > box[0] ? s->bx0 : box[0], x1 = s->bx1 < box[2] ? s->bx1 : box[2];
+        int y0 = s->by0 > box[1] ? s->by0 : box[1], y1 = s->by1 < box[3] ? s->by1 : box[3];
+        uint32_t bg = 0;
+        memcpy(&bg, &p->bg, sizeof(bg));
+        for (int x = x0; x < x1; ++x) c->row[x - x0] = bg;
+        for (int y = y0; y < y1; ++y) blend_row(c->surface + (size_t)y * (size_t)c->w + x0, c->row, x1 - x0, WHITE);
+    }
+
+    int x0 = s->x0 > box[0] ? s->x0 : box[0], x1 = s->x1 < box[2] ? s->x1 : box[2];
+    int y0 = s->y0 > box[1] ? s->y0 : box[1], y1 = s->y1 < box[3] ? s->y1 : box[3];
+    if (x0 >= x1 || y0 >= y1) return;
+    int fw = s->x1 - s->x0, fh = s->y1 - s->y0;
+    bool unscaled = (fw == p->texW && fh == p->texH);
+    for (int y = y0; y < y1; ++y) {
+        int sy = (int)(((int64_t)(y - s->y0) * p->texH) / fh);
+        const uint32_t* srcRow = p->framePixels + (size_t)sy * (size_t)p->texW;
+        const uint32_t* span = srcRow + (x0 - s->x0);
+        if (!unscaled) {
+            for (int x = x0; x < x1; ++x) c->row[x - x0] = srcRow[((int64_t)(x - s->x0) * p->texW) / fw];
+            span = c->row;
+        }
+        blend_row(c->surface + (size_t)y * (size_t)c->w + x0, span, x1 - x0, s->tint);
+    }
+}
+
+
+/* Recompute the player's texture and pixel-buffer footprint and fold it into the global totals. */
+static void account_player(dlrl_Player* p)
+{
+    size_t gpu = 0, cpu = 0;
+    if (p->tex.id) gpu += surface_bytes(p->tex.width, p->tex.height);
+    gpu += p->bake.bytes;
+    if (!p->evicted) cpu += surface_bytes(p->texW, p->texH);
+    if (p->cache.frame) cpu += surface_bytes(p->cache.w, p->cache.h) * 3u;
+    for (int i = 0; i < DLRL_WARM_SLOTS; ++i) {
+        const dlrl_WarmSlot* s = &p->warm[i];
+        if (!s->used) continue;
+        if (s->frames) cpu += warm_frame_bytes(s) * (size_t)s->frameCount;
+        if (s->core) cpu += warm_frame_bytes(s);
+        if (s->tex.id) gpu += surface_bytes(s->tex.width, s->tex.height);
+    }
+    for (int i = 0; i < DLRL_THEME_VARIANTS; ++i) {
+        const dlrl_ThemeVariant* v = &p->variants[i];
+        if (!v->core) continue;
+        cpu += surface_bytes(p->texW, p->texH);
+        gpu += v->bake.bytes;
+        if (v->cache.frame) cpu += surface_bytes(v->cache.w, v->cache.h) * 3u;
+    }
+    g_dlrl.gpuBytes = g_dlrl.gpuBytes - p->gpuBytes + gpu;
+    g_dlrl.cpuBytes = g_dlrl.cpuBytes - p->cpuBytes + cpu;
+    p->gpuBytes = gpu;
+    p->cpuBytes = cpu;
+}
+
+/* Release the texture, the core's pixel buffer and warm slots; dlrl_Update/dlrl_Draw rebuild them. */
+static void evict_player(dlrl_Player* p)
+{
+    release_warm_slots(p, false);
+    release_variants(p);
+    release_texture(p->tex);
+    p->tex = (Texture2D){0};
+    free_bake_sheets(p);
+    cache_close(p);
+    dotlottie_resize(p->core, 1, 1);
+    p->evicted = true;
+    g_dlrl.evictedCount++;
+    account_player(p);
+}
+
+static bool over_budget(void)
+{
+    const dlrl_InitOptions* o = &g_dlrl.opts;
+    return (o->gpu_budget_bytes && g_dlrl.gpuBytes + g_dlrl.poolBytes > o->gpu_budget_bytes) ||
+           (o->cpu_budget_bytes && g_dlrl.cpuBytes > o->cpu_budget_bytes);
+}
+
+/* Evict least recently drawn players until under budget; `keep` is the player in use right now. */
+static void enforce_budget(const dlrl_Player* keep)
+{
+    while (over_budget() && g_dlrl.poolCount > 0) pool_drop_oldest();
+    while (over_budget()) {
+        dlrl_Player* victim = NULL;
+        for (dlrl_Player* it = g_dlrl.players; it; it = it->next) {
+            if (it == keep || it->evicted) continue;
+            if (!victim || it->drawStamp < victim->drawStamp) victim = it;
+        }
+        if (!victim) return;
+        evict_player(victim);
+        while (over_budget() && g_dlrl.poolCount > 0) pool_drop_oldest();
+    }
+}
+
+static bool restore_player(dlrl_Player* p)
+{
+    if (!p->evicted) return true;
+    if (dotlottie_resize(p->core, (uint32_t)p->texW, (uint32_t)p->texH) != DOTLOTTIE_SUCCESS ||
+            !create_texture(p)) {
+        return false;
+    }
+    p->evicted = false;
+    g_dlrl.evictedCount--;
+    if (p->bake.wanted) build_bake(p);
+    content_changed(p);
+
+    const uint32_t* ptr = NULL;
+    dotlottie_render(p->core);
+    dotlottie_buffer_ptr(p->core, &ptr);
+    upload_frame(p->tex, p->texW, p->texH, ptr);
+    account_player(p);
+    enforce_budget(p);
+    return true;
+}
+
+void dlrl_Unload(dlrl_Player* p)
+{
+    if (!p) return;
+    unregister_player(p);
+    release_warm_slots(p, false);
+    release_variants(p);
+    free_bake_sheets(p);
+    cache_close(p);
+    release_texture(p->tex);
+    if (p->core) dotlottie_destroy(p->core);
+    free_markers(p);
+    if (p->layerCache) MemFree(p->layerCache);
+    if (p->source) MemFree(p->source);
+    release_theme(p->theme);
+    MemFree(p);
+}
+
+void dlrl_Play(dlrl_Player* p){ if(!p) return; dotlottie_play(p->core); p->playing = true; }
+void dlrl_Pause(dlrl_Player* p){ if(!p) return; dotlottie_pause(p->core); p->playing = false; }
+void dlrl_Stop(dlrl_Player* p){
+    if(!p) return;
+    dotlottie_stop(p->core);
+    p->playing=false;
+    reset_timeline(p);
+    dotlottie_set_frame(p->core, 0.f);
+}
+bool dlrl_IsPlaying(const dlrl_Player* p){ return p && p->playing; }
+
+void dlrl_SetSpeed(dlrl_Player* p, float speed){
+    if (!p) return;
+    p->speedSign = (speed < 0.f) ? -1.f : 1.f;
+    p->speed = (speed < 0.f) ? -speed : speed;
+}
+void dlrl_SetLoop(dlrl_Player* p, bool loop){
+    if(!p) return;
+    p->loop = loop;
+    if (loop) p->completed = false;
+}
+void dlrl_SetMode(dlrl_Player* p, dlrl_Mode m){
+    if(!p) return;
+    double t = p->time;
+    p->mode = m;
+    p->phase = time_to_phase(p, t);
+    p->completed = false;
+}
+void dlrl_SetFixedStep(dlrl_Player* p, double step_seconds){
+    if(!p) return;
+    p->fixedStep = (step_seconds > 0.0) ? step_seconds : 0.0;
+    p->accum = 0.0;
+}
+dlrl_StepInfo dlrl_LastStep(const dlrl_Player* p){ return p ? p->lastStep : (dlrl_StepInfo){0}; }
+
+/* Apply the latest dlrl_Resize request; the pooled texture is kept when the bucket is unchanged. */
+static void apply_resize(dlrl_Player* p)
+{
+    p->resizePending = false;
+    uint32_t w = p->pendingW ? p->pendingW : (p->natural.x > 0.f ? (uint32_t)p->natural.x : DLRL_FALLBACK_SURFACE);
+    uint32_t h = p->pendingH ? p->pendingH : (p->natural.y > 0.f ? (uint32_t)p->natural.y : DLRL_FALLBACK_SURFACE);
+    bool resized = (int)w != p->texW || (int)h != p->texH;
+
+    /* Resize the surface first; on failure the player keeps its size, warm frames and variants. */
+    if (resized && !p->evicted) {
+        int oldW = p->texW, oldH = p->texH;
+        if (dotlottie_resize(p->core, w, h) != DOTLOTTIE_SUCCESS) {
+            TraceLog(LOG_WARNING, "DLRL: resize to %ux%u failed; keeping %dx%d", w, h, oldW, oldH);
+            return;
+        }
+        if (!recreate_texture(p, w, h)) {
+            TraceLog(LOG_WARNING, "DLRL: no %ux%u texture; keeping %dx%d", w, h, oldW, oldH);
+            dotlottie_resize(p->core, (uint32_t)oldW, (uint32_t)oldH);
+            recreate_texture(p, (uint32_t)oldW, (uint32_t)oldH);
+            content_changed(p);
+            return;
+        }
+    }
+    p->requestedW = p->pendingW;
+    p->requestedH = p->pendingH;
+    p->autoWidth = (p->pendingW == 0);
+    p->autoHeight = (p->pendingH == 0);
+    if (!resized) return;
+
+    release_warm_slots(p, false);
+    release_variants(p);
+    if (p->evicted) {
+        p->texW = (int)w;
+        p->texH = (int)h;
+        return;
+    }
+    if (p->bake.wanted) build_bake(p);
+    content_changed(p);
+}
+
+static void update_player(dlrl_Player* p, float dt, bool upload)
+{
+    if (p->resizePending) {
+        p->resizeTimer -= dt;
+        if (p->resizeTimer <= 0.f) apply_resize(p);
+    }
+    if (!restore_player(p)) return;
+    warm_step(p);
+    account_player(p);
+    enforce_budget(p);
+    dlrl_StepInfo info = {0};
+    if (p->playing) {
+        double delta = (double)dt;
+        if (p->fixedStep > 0.0) {
+            p->accum += delta;
+            double steps = floor(p->accum / p->fixedStep);
+            p->accum -= steps * p->fixedStep;
+            info.steps = (steps > 1e9) ? 1000000000 : (int)steps;
+            delta = steps * p->fixedStep;
+        }
+        advance_phase(p, delta * (double)p->speed * (double)p->speedSign, &info);
+        p->time = phase_to_time(p, p->phase);
+    }
+    info.time = p->time;
+    p->lastStep = info;
+
+    float normalized = (p->duration > 0.f) ? (float)(p->time / (double)p->duration) : 0.f;
+    if (normalized < 0.f) normalized = 0.f;
+    if (normalized > 1.f) normalized = 1.f;
+    float segmentSpan = (p->segmentFrameCount > 1.f) ? (p->segmentFrameCount - 1.f) : 0.f;
+    float targetFrame = p->segmentStartFrame + normalized * segmentSpan;
+    dotlottie_set_frame(p->core, targetFrame);
+    p->coreFrame = targetFrame;
+    if (bake_covers(p)) {
+        int k = (int)(targetFrame - p->bake.startFrame + 0.5f);
+        p->bake.frame = (k < 0) ? 0 : (k >= p->bake.frameCount ? p->bake.frameCount - 1 : k);
+        return;
+    }
+    const uint32_t* ptr = serve_warm_frame(p, targetFrame);
+    if (!ptr && p->cache.pending) ptr = cache_present(p, targetFrame);
+    if (!ptr) {
+        dotlottie_render(p->core);
+        dotlottie_buffer_ptr(p->core, &ptr);
+    }
+    present_frame(p, ptr, targetFrame, upload);
+}
+
+void dlrl_Update(dlrl_Player* p, float dt)
+{
+    if (!p) return;
+    update_player(p, dt, true);
+}
+
+void dlrl_Draw(dlrl_Player* p, Rectangle dest, float rotation, Color tint)
+{
+    if (!p) return;
+    p->drawStamp = ++g_dlrl.drawCounter;
+    p->drawnAt = g_dlrl.drawCounter;
+    if (!restore_player(p)) return;
+    Texture2D tex;
+    Rectangle src;
+    current_source(p, &tex, &src);
+    if (tex.id == 0) return;
+
+    if (p->bg.a > 0) {
+        DrawRectangleRec(dest, p->bg);
+    }
+
+    Rectangle fit = {0};
+    fit_rect(p->texW, p->texH, dest, p->fit, p->align, &fit);
+    if (!p->drawn || memcmp(&fit, &p->drawFit, sizeof(fit)) != 0 || rotation != p->drawRotation) {
+        p->drawn = true;
+        p->drawFit = fit;
+        p->drawRotation = rotation;
+        if (p->hitLayers > 0) g_dlrl.hitEpoch++;
+    }
+    Vector2 origin = { fit.width * 0.5f, fit.height * 0.5f };
+    Vector2 center = { fit.x + origin.x, fit.y + origin.y };
+
+    DrawTexturePro(tex, src,
+            (Rectangle){ center.x, center.y, fit.width, fit.height },
+            origin, rotation, tint);
+}
+
+void dlrl_DrawMany(dlrl_Player* p, const Rectangle* dests, const float* rotations, const Color* tints, int n)
+{
+    if (!p || !dests || n <= 0) return;
+    p->drawStamp = ++g_dlrl.drawCounter;
+    if (!restore_player(p)) return;
+    Texture2D tex;
+    Rectangle src;
+    current_source(p, &tex, &src);
+    if (tex.id == 0) return;
+
+    if (p->bg.a > 0) {
+        for (int i = 0; i < n; ++i) DrawRectangleRec(dests[i], p->bg);
+    }
+
+    float u0 = src.x / (float)tex.width, v0 = src.y / (float)tex.height;
+    float u1 = (src.x + src.width) / (float)tex.width, v1 = (src.y + src.height) / (float)tex.height;
+    Rectangle fit = {0};
+    float lastW = -1.f, lastH = -1.f;
+    for (int base = 0; base < n; base += DLRL_DRAW_CHUNK) {
+        int end = (n - base > DLRL_DRAW_CHUNK) ? base + DLRL_DRAW_CHUNK : n;
+        rlCheckRenderBatchLimit(4 * (end - base));
+        rlSetTexture(tex.id);
+        rlBegin(RL_QUADS);
+        rlNormal3f(0.f, 0.f, 1.f);
+        for (int i = base; i < end; ++i) {
+            Rectangle d = dests[i];
+            /* Fit depends only on the dest size; reuse it across equally sized quads. */
+            if (d.width != lastW || d.height != lastH) {
+                fit_rect(p->texW, p->texH, (Rectangle){ 0, 0, d.width, d.height }, p->fit, p->align, &fit);
+                lastW = d.width;
+                lastH = d.height;
+            }
+            float hw = fit.width * 0.5f, hh = fit.height * 0.5f;
+            float cx = d.x + fit.x + hw, cy = d.y + fit.y + hh;
+            float c = 1.f, s = 0.f;
+            if (rotations && rotations[i] != 0.f) {
+                float r = rotations[i] * (PI / 180.f);
+                c = cosf(r);
+                s = sinf(r);
+            }
+            Color t = tints ? tints[i] : WHITE;
+            rlColor4ub(t.r, t.g, t.b, t.a);
+            rlTexCoord2f(u0, v0);
+            rlVertex2f(cx - hw * c + hh * s, cy - hw * s - hh * c);
+            rlTexCoord2f(u0, v1);
+            rlVertex2f(cx - hw * c - hh * s, cy - hw * s + hh * c);
+            rlTexCoord2f(u1, v1);
+            rlVertex2f(cx + hw * c - hh * s, cy + hw * s + hh * c);
+            rlTexCoord2f(u1, v0);
+            rlVertex2f(cx + hw * c + hh * s, cy + hw * s - hh * c);
+        }
+        rlEnd();
+        rlSetTexture(0);
+    }
+}
+
+float dlrl_Duration(const dlrl_Player* p){ return p ? p->duration : 0.f; }
+float dlrl_CurrentTime(const dlrl_Player* p){ return p ? (float)p->time : 0.f; }
+int   dlrl_TotalFrames(const dlrl_Player* p){ float f=0; return (p && dotlottie_total_frames(p->core, &f)==0) ? (int)f : 0; }
+int   dlrl_CurrentFrame(const dlrl_Player* p){ float f=0; return (p && dotlottie_current_frame(p->core, &f)==0) ? (int)f : 0; }
+Vector2 dlrl_NaturalSize(const dlrl_Player* p){ return p ? p->natural : (Vector2){0,0}; }
+Texture2D dlrl_GetTexture(const dlrl_Player* p){
+    Texture2D tex = {0};
+    Rectangle src = {0};
+    if (p) current_source(p, &tex, &src);
+    return tex;
+}
+Rectangle dlrl_GetSourceRect(const dlrl_Player* p){
+    Texture2D tex = {0};
+    Rectangle src = {0};
+    if (p) current_source(p, &tex, &src);
+    return src;
+}
+
+bool dlrl_Resize(dlrl_Player* p, int width, int height)
+{
+    if (!p || width < 0 || height < 0) return false;
+    p->pendingW = (uint32_t)width;
+    p->pendingH = (uint32_t)height;
+    p->resizePending = true;
+    p->resizeTimer = g_dlrl.opts.resize_settle_seconds;
+    return true;
+}
+
+/* Common tail of a theme switch: frames rendered under the old theme are stale. */
+static void theme_changed(dlrl_Player* p)
+{
+    reset_warm_frames(p);
+    if (p->bake.wanted) build_bake(p);
+    content_changed(p);
+    account_player(p);
+    enforce_budget(p);
+}
+
+dlrl_ThemeHandle dlrl_ThemeFromId(const char* theme_id){ return intern_theme(false, theme_id); }
+dlrl_ThemeHandle dlrl_ThemeFromData(const char* theme_json){ return intern_theme(true, theme_json); }
+
+bool dlrl_PrepareTheme(dlrl_Player* p, dlrl_ThemeHandle theme)
+{
+    if (!p || (theme != DLRL_DEFAULT_THEME && !theme_entry(theme))) return false;
+    if (theme == p->theme) return true;
+    if (!restore_player(p)) return false;
+    dlrl_ThemeVariant* v = find_variant(p, theme);
+    if (!v) {
+        settle_fonts(true);
+        struct DotLottiePlayer* core = open_variant_core(p, theme);
+        if (!core) return false;
+        v = claim_variant(p);
+        v->core = core;
+        v->theme = theme;
+        retain_theme(theme);
+        /* Bake and open the cache now so that dlrl_UseTheme only exchanges pointers. */
+        v->bake = (dlrl_Bake){ .wanted = p->bake.wanted, .marker = p->bake.marker, .format = p->bake.format };
+        v->cache = (dlrl_FrameCache){ .enabled = p->cache.enabled, .assetHashed = p->cache.assetHashed,
+                                      .assetHash = p->cache.assetHash };
+        swap_variant(p, v);
+        if (p->bake.wanted) build_bake(p);
+        cache_open(p);
+        swap_variant(p, v);
+        account_player(p);
+        enforce_budget(p);
+    }
+    v->lastUse = ++g_dlrl.themeClock;
+    return true;
+}
+
+bool dlrl_UseTheme(dlrl_Player* p, dlrl_ThemeHandle theme)
+{
+    if (!p || (theme != DLRL_DEFAULT_THEME && !theme_entry(theme))) return false;
+    if (theme == p->theme) return true;
+    dlrl_ThemeVariant* v = find_variant(p, theme);
+    if (!v) {
+        if (!apply_theme(p->core, theme)) return false;
+        retain_theme(theme);
+        release_theme(p->theme);
+        p->theme = theme;
+        theme_changed(p);
+        return true;
+    }
+
+    dlrl_Bake want = p->bake;
+    swap_variant(p, v);
+    v->lastUse = ++g_dlrl.themeClock;
+    /* Only a bake request made after dlrl_PrepareTheme, or a cache that failed to open, costs more. */
+    p->bake.wanted = want.wanted;
+    if (want.wanted && (p->bake.sheetCount == 0 || p->bake.marker != want.marker || p->bake.format != want.format)) {
+        p->bake.marker = want.marker;
+        p->bake.format = want.format;
+        p->bake.wanted = build_bake(p);
+    } else if (!want.wanted && p->bake.sheetCount > 0) {
+        free_bake_sheets(p);
+    }
+    if (p->cache.enabled && !p->cache.pending) cache_open(p);
+    dotlottie_set_frame(p->core, p->coreFrame);
+    if (p->playing) dotlottie_play(p->core);
+    reset_warm_frames(p);
+    frames_invalidated(p);
+    account_player(p);
+    enforce_budget(p);
+    return true;
+}
+
+int dlrl_UseThemeMany(dlrl_Player* const* players, int count, dlrl_ThemeHandle theme)
+{
+    int switched = 0;
+    for (int i = 0; players && i < count; ++i) {
+        if (players[i] && dlrl_UseTheme(players[i], theme)) ++switched;
+    }
+    return switched;
+}
+
+void dlrl_ReleaseTheme(dlrl_ThemeHandle theme){ release_theme(theme); }
+
+/* The temporary reference is dropped again, so an id the player rejects is not kept. */
+bool dlrl_SetTheme(dlrl_Player* p, const char* theme_id)
+{
+    if (!p) return false;
+    dlrl_ThemeHandle theme = dlrl_ThemeFromId(theme_id);
+    bool ok = theme != DLRL_INVALID_THEME && dlrl_UseTheme(p, theme);
+    release_theme(theme);
+    return ok;
+}
+
+bool dlrl_SetThemeData(dlrl_Player* p, const char* theme_json)
+{
+    if (!p) return false;
+    dlrl_ThemeHandle theme = dlrl_ThemeFromData(theme_json);
+    bool ok = theme != DLRL_INVALID_THEME && dlrl_UseTheme(p, theme);
+    release_theme(theme);
+    return ok;
+}
+
+/* Swap in a warmed core and its pre-sized texture; no load or texture allocation on the switch. */
+static void adopt_warm_animation(dlrl_Player* p, int slot)
+{
+    dlrl_WarmSlot* s = &p->warm[slot];
+    end_serving(p);
+    release_texture(p->tex);
+    if (p->core) dotlottie_destroy(p->core);
+    p->core = s->core;
+    p->tex = s->tex;
+    p->texW = s->w;
+    p->texH = s->h;
+    s->core = NULL;
+    s->tex = (Texture2D){0};
+    s->consumed = true;
+    s->hit = true;
+
+    dlrl_CoreInfo info = {
+        .naturalW = s->natural.x, .naturalH = s->natural.y,
+        .duration = s->duration, .totalFrames = s->totalFrames,
+        .w = (uint32_t)s->w, .h = (uint32_t)s->h
+    };
+    apply_core_info(p, &info);
+    if (p->playing) dotlottie_play(p->core);
+    p->servedSlot = slot;
+    upload_frame(p->tex, p->texW, p->texH, s->frames);
+}
+
+bool dlrl_SetAnimation(dlrl_Player* p, const char* animation_id)
+{
+    if (!p || !animation_id) return false;
+    if (!restore_player(p)) return false;
+    int slot = find_warm_animation(p, animation_id);
+    if (slot >= 0 && p->warm[slot].framesReady > 0 && warm_matches(p, &p->warm[slot])) {
+        adopt_warm_animation(p, slot);
+        p->warmStats.animation_hits++;
+    } else {
+        p->warmStats.animation_misses++;
+        settle_fonts(true);
+        uint32_t loadW = p->requestedW ? p->requestedW : DLRL_FALLBACK_SURFACE;
+        uint32_t loadH = p->requestedH ? p->requestedH : DLRL_FALLBACK_SURFACE;
+        if (dotlottie_load_animation(p->core, animation_id, loadW, loadH) != DOTLOTTIE_SUCCESS) {
+            return false;
+        }
+        dlrl_CoreInfo info;
+        if (!settle_core(p->core, p->requestedW, p->requestedH, loadW, loadH, &info)) {
+            return false;
+        }
+        if (!recreate_texture(p, info.w, info.h)) {
+            return false;
+        }
+        end_serving(p);
+        if (slot >= 0) release_warm_slot(p, slot);
+        apply_core_info(p, &info);
+    }
+
+    release_warm_slots(p, true);
+    release_variants(p);
+    free_bake_sheets(p);
+    p->bake.wanted = false;
+    free_markers(p);
+    load_markers(p);
+    content_changed(p);
+    account_player(p);
+    enforce_budget(p);
+    return true;
+}
+
+bool dlrl_SetMarker(dlrl_Player* p, const char* marker_name)
+{
+    if (!p) return false;
+    if (!marker_name || !marker_name[0]) return dlrl_SetMarkerHandle(p, DLRL_NO_MARKER);
+    int i = find_marker(p, marker_name);
+    return (i >= 0) ? dlrl_SetMarkerHandle(p, marker_handle(p, i)) : false;
+}
+
+dlrl_MarkerHandle dlrl_FindMarker(const dlrl_Player* p, const char* marker_name)
+{
+    return p ? marker_handle(p, find_marker(p, marker_name)) : DLRL_NO_MARKER;
+}
+
+dlrl_MarkerHandle dlrl_FindMarkerN(const dlrl_Player* p, const char* marker_name, size_t length)
+{
+    return p ? marker_handle(p, find_marker_n(p, marker_name, length)) : DLRL_NO_MARKER;
+}
+
+bool dlrl_SetMarkerHandle(dlrl_Player* p, dlrl_MarkerHandle handle)
+{
+    if (!p) return false;
+    int marker = (handle == DLRL_NO_MARKER) ? -1 : marker_index(p, handle);
+    if (handle != DLRL_NO_MARKER && marker < 0) return false;
+    end_serving(p);
+    if (marker < 0) {
+        apply_segment(p, 0.f, (float)p->totalFrames, p->assetDuration);
+        p->activeMarker = -1;
+        return true;
+    }
+    const dlrl_Marker* m = &p->markers[marker];
+    apply_segment(p, m->startFrame, m->frameCount, m->durationSeconds);
+    p->activeMarker = marker;
+
+    int slot = find_warm_marker(p, marker);
+    if (slot >= 0 && p->warm[slot].framesReady > 0 && warm_matches(p, &p->warm[slot]) &&
+            p->warm[slot].w == p->texW && p->warm[slot].h == p->texH) {
+        p->warm[slot].hit = true;
+        p->servedSlot = slot;
+        p->warmStats.marker_hits++;
+        upload_frame(p->tex, p->texW, p->texH, p->warm[slot].frames);
+    } else {
+        p->warmStats.marker_misses++;
+    }
+    return true;
+}
+
+int dlrl_GetMarkers(const dlrl_Player* p, dlrl_MarkerInfo* out, int capacity)
+{
+    if (!p) return 0;
+    int n = (out && capacity > 0) ? (capacity < p->markerCount ? capacity : p->markerCount) : 0;
+    for (int i = 0; i < n; ++i) {
+        const dlrl_Marker* m = &p->markers[i];
+        out[i] = (dlrl_MarkerInfo){
+            .name = m->name,
+            .start_frame = m->startFrame,
+            .frame_count = m->frameCount,
+            .duration = m->durationSeconds
+        };
+    }
+    return p->markerCount;
+}
+
+int dlrl_MarkerCount(const dlrl_Player* p)
+{
+    return p ? p->markerCount : 0;
+}
+
+const char* dlrl_MarkerName(const dlrl_Player* p, int index)
+{
+    if (!p || index < 0 || index >= p->markerCount || !p->markers) return NULL;
+    return p->markers[index].name;
+}
+
+bool dlrl_WarmMarker(dlrl_Player* p, const char* marker_name)
+{
+    if (!p || !marker_name || !marker_name[0]) return false;
+    int m = find_marker(p, marker_name);
+    if (m < 0) return false;
+    if (find_warm_marker(p, m) >= 0) return true;
+
+    int frameCount = (int)p->markers[m].frameCount;
+    if (frameCount > DLRL_WARM_FRAMES) frameCount = DLRL_WARM_FRAMES;
+    if (frameCount < 1) frameCount = 1;
+    size_t bytes = (size_t)p->texW * (size_t)p->texH * 4u;
+    unsigned char* frames = (unsigned char*)MemAlloc((unsigned int)(bytes * (size_t)frameCount));
+    if (!frames) return false;
+
+    dlrl_WarmSlot* s = claim_warm_slot(p);
+    s->used = true;
+    s->marker = m;
+    copy_capped(s->id, sizeof(s->id), p->markers[m].name);
+    s->startFrame = p->markers[m].startFrame;
+    warm_track(p, s, p->markers[m].frameCount - 1.f);
+    s->frameCount = frameCount;
+    s->frames = frames;
+    s->w = p->texW;
+    s->h = p->texH;
+    account_player(p);
+    return true;
+}
+
+bool dlrl_WarmAnimation(dlrl_Player* p, const char* animation_id)
+{
+    if (!p || !animation_id || !animation_id[0]) return false;
+    if (p->sourceKind != DLRL_SOURCE_DOTLOTTIE) return false;
+    if (find_warm_animation(p, animation_id) >= 0) return true;
+    dlrl_WarmSlot* s = claim_warm_slot(p);
+    s->used = true;
+    s->isAnimation = true;
+    copy_capped(s->id, sizeof(s->id), animation_id);
+    return true;
+}
+
+void dlrl_ClearWarm(dlrl_Player* p)
+{
+    if (!p) return;
+    release_warm_slots(p, false);
+    account_player(p);
+}
+
+dlrl_WarmStats dlrl_GetWarmStats(const dlrl_Player* p)
+{
+    return p ? p->warmStats : (dlrl_WarmStats){0};
+}
+
+void dlrl_ResetWarmStats(dlrl_Player* p)
+{
+    if (p) p->warmStats = (dlrl_WarmStats){0};
+}
+
+dlrl_MemoryUsage dlrl_GetMemoryUsage(void)
+{
+    int players = 0;
+    for (const dlrl_Player* it = g_dlrl.players; it; it = it->next) ++players;
+    return (dlrl_MemoryUsage){
+        .gpu_bytes = g_dlrl.gpuBytes,
+        .cpu_bytes = g_dlrl.cpuBytes,
+        .gpu_budget_bytes = g_dlrl.opts.gpu_budget_bytes,
+        .cpu_budget_bytes = g_dlrl.opts.cpu_budget_bytes,
+        .players = players,
+        .evicted_players = g_dlrl.evictedCount
+    };
+}
+
+bool dlrl_BakeMarker(dlrl_Player* p, dlrl_MarkerHandle handle, dlrl_BakeFormat format)
+{
+    if (!p) return false;
+    int marker = (handle == DLRL_NO_MARKER) ? DLRL_NO_MARKER : marker_index(p, handle);
+    if (handle != DLRL_NO_MARKER && marker < 0) return false;
+    if (!restore_player(p)) return false;
+    p->bake.marker = marker;
+    p->bake.format = format;
+    p->bake.wanted = build_bake(p);
+    account_player(p);
+    enforce_budget(p);
+    return p->bake.wanted;
+}
+
+void dlrl_ClearBake(dlrl_Player* p)
+{
+    if (!p) return;
+    free_bake_sheets(p);
+    p->bake.wanted = false;
+    for (int i = 0; i < DLRL_THEME_VARIANTS; ++i) {
+        dlrl_ThemeVariant* v = &p->variants[i];
+        if (!v->core) continue;
+        swap_variant(p, v);
+        free_bake_sheets(p);
+        p->bake.wanted = false;
+        swap_variant(p, v);
+    }
+    account_player(p);
+}
+
+bool dlrl_IsBaked(const dlrl_Player* p, dlrl_BakeFormat* format)
+{
+    if (!p || p->bake.sheetCount == 0) return false;
+    if (format) *format = p->bake.actual;
+    return true;
+}
+
+size_t dlrl_CompressedSize(int width, int height, dlrl_BakeFormat format)
+{
+    if (width <= 0 || height <= 0) return 0;
+    size_t blocks = (size_t)((width + 3) / 4) * (size_t)((height + 3) / 4);
+    switch (format) {
+        case DLRL_BAKE_DXT1: return blocks * 8u;
+        case DLRL_BAKE_DXT5: return blocks * 16u;
+        case DLRL_BAKE_RGBA8: break;
+    }
+    return surface_bytes(width, height);
+}
+
+bool dlrl_CompressImage(const unsigned char* rgba, int width, int height, dlrl_BakeFormat format, unsigned char* out)
+{
+    if (!rgba || !out || width <= 0 || height <= 0) return false;
+    if (format == DLRL_BAKE_RGBA8) {
+        memcpy(out, rgba, surface_bytes(width, height));
+    } else {
+        compress_blocks(rgba, width, height, format, out);
+    }
+    return true;
+}
+
+bool dlrl_FlushFrameCache(dlrl_Player* p)
+{
+    if (!p || !p->cache.pending) return false;
+    return cache_flush(&p->cache);
+}
+
+dlrl_CacheStats dlrl_GetCacheStats(const dlrl_Player* p)
+{
+    if (!p) return (dlrl_CacheStats){0};
+    const dlrl_FrameCache* c = &p->cache;
+    int stored = 0;
+    for (int f = 0; c->entries && f < c->frameCount; ++f) {
+        if (c->entries[f].kind != DLRL_CACHE_MISSING) ++stored;
+    }
+    return (dlrl_CacheStats){
+        .hits = c->hits,
+        .misses = c->misses,
+        .frames_on_disk = stored,
+        .frames_pending = c->pendingCount,
+        .file_bytes = c->entries ? c->mapSize : 0
+    };
+}
+
+dlrl_Canvas* dlrl_LoadCanvas(int width, int height)
+{
+    if (width <= 0 || height <= 0) return NULL;
+    dlrl_Canvas* c = (dlrl_Canvas*)MemAlloc(sizeof(dlrl_Canvas));
+    if (!c) return NULL;
+    size_t n = (size_t)width * (size_t)height;
+    c->w = width;
+    c->h = height;
+    c->surface = (uint32_t*)MemAlloc((unsigned int)(n * 4u));
+    c->staging = (uint32_t*)MemAlloc((unsigned int)(n * 4u));
+    c->row = (uint32_t*)MemAlloc((unsigned int)((size_t)(width > height ? width : height) * 4u));
+    c->tex = make_texture(width, height);
+    c->fresh = true;
+    if (!c->surface || !c->staging || !c->row || c->tex.id == 0) {
+        dlrl_UnloadCanvas(c);
+        return NULL;
+    }
+    g_dlrl.gpuBytes += surface_bytes(width, height);
+    g_dlrl.cpuBytes += surface_bytes(width, height) * 2u;
+    return c;
+}
+
+void dlrl_UnloadCanvas(dlrl_Canvas* c)
+{
+    if (!c) return;
+    if (c->tex.id != 0 && c->surface && c->staging && c->row) {
+        g_dlrl.gpuBytes -= surface_bytes(c->w, c->h);
+        g_dlrl.cpuBytes -= surface_bytes(c->w, c->h) * 2u;
+    }
+    if (c->tex.id != 0) UnloadTexture(c->tex);
+    if (c->surface) MemFree(c->surface);
+    if (c->staging) MemFree(c->staging);
+    if (c->row) MemFree(c->row);
+    if (c->slots) MemFree(c->slots);
+    MemFree(c);
+}
+
+void dlrl_UpdateCanvas(dlrl_Canvas* c, const dlrl_CanvasLayer* layers, int count, float dt)
+{
+    if (!c || count < 0 || (count > 0 && !layers)) return;
+    if (count > c->slotCap) {
+        dlrl_CanvasSlot* grown = (dlrl_CanvasSlot*)MemRealloc(c->slots, (unsigned int)(sizeof(dlrl_CanvasSlot) * (size_t)count));
+        if (!grown) return;
+        c->slots = grown;
+        c->slotCap = count;
+    }
+
+    /* Canvas players count as drawn, so the budget evicts others first. */
+    for (int i = 0; i < count; ++i) {
+        if (layers[i].player) layers[i].player->drawStamp = ++g_dlrl.drawCounter;
+    }
+    uint64_t pass = ++g_dlrl.canvasPasses;
+    for (int i = 0; i < count; ++i) {
+        dlrl_Player* p = layers[i].player;
+        /* A player listed twice is advanced once per call. */
+        if (!p || p->canvasPass == pass) continue;
+        p->canvasPass = pass;
+        update_player(p, dt, false);
+    }
+
+    int box[4] = {0};
+    if (c->fresh) grow_box(box, 0, 0, c->w, c->h);
+    int total = (count > c->slotCount) ? count : c->slotCount;
+    for (int i = 0; i < total; ++i) {
+        dlrl_CanvasSlot next = {0};
+        if (i < count) canvas_place(c, &layers[i], &next);
+        if (i < c->slotCount && i < count && slots_equal(&c->slots[i], &next)) continue;
+        if (i < c->slotCount) grow_box_slot(c, box, &c->slots[i]);
+        if (i < count) {
+            grow_box_slot(c, box, &next);
+            c->slots[i] = next;
+        }
+    }
+    c->slotCount = count;
+    c->fresh = false;
+    c->dirty = (Rectangle){0};
+    if (box[0] >= box[2] || box[1] >= box[3]) return;
+
+    for (int y = box[1]; y < box[3]; ++y) {
+        memset(c->surface + (size_t)y * (size_t)c->w + box[0], 0, (size_t)(box[2] - box[0]) * 4u);
+    }
+    for (int i = 0; i < count; ++i) {
+        if (canvas_visible(c->slots[i].player)) canvas_blend_layer(c, &c->slots[i], box);
+    }
+
+    int bw = box[2] - box[0], bh = box[3] - box[1];
+    for (int y = 0; y < bh; ++y) {
+        memcpy(c->staging + (size_t)y * (size_t)bw,
+               c->surface + (size_t)(box[1] + y) * (size_t)c->w + box[0], (size_t)bw * 4u);
+    }
+    c->dirty = (Rectangle){ (float)box[0], (float)box[1], (float)bw, (float)bh };
+    UpdateTextureRec(c->tex, c->dirty, c->staging);
+}
+
+void dlrl_DrawCanvas(const dlrl_Canvas* c, Rectangle dest, Color tint)
+{
+    if (!c) return;
+    /* The surface is premultiplied, so the tint is too. */
+    Color pm = {
+        (unsigned char)mul_div255(tint.r, tint.a), (unsigned char)mul_div255(tint.g, tint.a),
+        (unsigned char)mul_div255(tint.b, tint.a), tint.a
+    };
+    BeginBlendMode(BLEND_ALPHA_PREMULTIPLY);
+    DrawTexturePro(c->tex, (Rectangle){ 0, 0, (float)c->w, (float)c->h }, dest, (Vector2){0, 0}, 0.f, pm);
+    EndBlendMode();
+}
+
+Texture2D dlrl_GetCanvasTexture(const dlrl_Canvas* c)
+{
+    return c ? c->tex : (Texture2D){0};
+}
+
+Rectangle dlrl_CanvasDirtyRect(const dlrl_Canvas* c)
+{
+    return c ? c->dirty : (Rectangle){0};
+}
+
+/* ---- Headless rendering to a frame sink ---- */
+
+typedef struct {
+    const dlrl_RenderJob* job;
+    dlrl_SourceKind kind;
+    const unsigned char* source;
+    size_t sourceSize;
+    uint32_t w, h;
+    float duration;          /* asset */
+    int totalFrames;         /* asset, counted as players count it */
+    double start;
+    double fps;
+    int frameCount;          /* output */
+    int chunkFrames;
+    int chunkCount;
+    int inFlight;            /* chunk buffers; bounds memory and how far workers run ahead */
+    unsigned char* buffers;  /* inFlight * chunkFrames frames */
+    int* slotChunk;          /* chunk held by each buffer, -1 when free */
+    int nextChunk;
+    int written;
+    bool failed;
+#if defined(DLRL_HAVE_PTHREADS)
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+#endif
+} dlrl_RenderQueue;
+
+typedef struct {
+    dlrl_RenderQueue* q;
+    struct DotLottiePlayer* core;
+} dlrl_RenderWorker;
+
+static size_t render_frame_bytes(const dlrl_RenderQueue* q)
+{
+    return (size_t)q->w * (size_t)q->h * 4u;
+}
+
+static struct DotLottiePlayer* open_render_core(const dlrl_RenderQueue* q, dlrl_CoreInfo* info)
+{
+    const dlrl_Config* cfg = q->job->config;
+    struct DotLottiePlayer* core = make_core(cfg);
+    if (!core) return NULL;
+    uint32_t requestedW = (uint32_t)(cfg && cfg->width  > 0 ? cfg->width  : 0);
+    uint32_t requestedH = (uint32_t)(cfg && cfg->height > 0 ? cfg->height : 0);
+    uint32_t loadW = requestedW ? requestedW : DLRL_FALLBACK_SURFACE;
+    uint32_t loadH = requestedH ? requestedH : DLRL_FALLBACK_SURFACE;
+    if (!load_source(core, q->kind, q->source, q->sourceSize, loadW, loadH) ||
+            !settle_core(core, requestedW, requestedH, loadW, loadH, info)) {
+        dotlottie_destroy(core);
+        return NULL;
+    }
+    return core;
+}
+
+/* Output frame k samples the asset at start + k / fps, held on the last frame past the end. */
+static bool render_chunk(const dlrl_RenderQueue* q, struct DotLottiePlayer* core, int chunk, unsigned char* out)
+{
+    size_t bytes = render_frame_bytes(q);
+    int first = chunk * q->chunkFrames;
+    int count = (q->frameCount - first < q->chunkFrames) ? q->frameCount - first : q->chunkFrames;
+    float lastFrame = (q->totalFrames > 1) ? (float)(q->totalFrames - 1) : 0.f;
+    float spf = frame_step_seconds(q->duration, q->totalFrames);
+    for (int k = 0; k < count; ++k) {
+        double t = q->start + (double)(first + k) / q->fps;
+        float f = (spf > 0.f) ? (float)(t / (double)spf) : 0.f;
+        if (f > lastFrame) f = lastFrame;
+        const uint32_t* ptr = NULL;
+        dotlottie_set_frame(core, f);
+        dotlottie_render(core);
+        dotlottie_buffer_ptr(core, &ptr);
+        if (!ptr) return false;
+        memcpy(out + bytes * (size_t)k, ptr, bytes);
+    }
+    return true;
+}
+
+static bool write_chunk(const dlrl_RenderQueue* q, const dlrl_FrameSink* sink, int chunk, const unsigned char* frames)
+{
+    size_t bytes = render_frame_bytes(q);
+    int first = chunk * q->chunkFrames;
+    int count = (q->frameCount - first < q->chunkFrames) ? q->frameCount - first : q->chunkFrames;
+    for (int k = 0; k < count; ++k) {
+        if (!sink->frame(sink->user, frames + bytes * (size_t)k, first + k)) return false;
+    }
+    return true;
+}
+
+#if defined(DLRL_HAVE_PTHREADS)
+/* Claim chunks in order, at most inFlight ahead of the writer, and render each into its ring slot. */
+static void* render_worker(void* arg)
+{
+    dlrl_RenderWorker* wk = (dlrl_RenderWorker*)arg;
+    dlrl_RenderQueue* q = wk->q;
+    size_t chunkBytes = render_frame_bytes(q) * (size_t)q->chunkFrames;
+    if (!wk->core) {
+        dlrl_CoreInfo info;
+        wk->core = open_render_core(q, &info);
+        if (wk->core && (info.w != q->w || info.h != q->h)) {
+            dotlottie_destroy(wk->core);
+            wk->core = NULL;
+        }
+    }
+    for (;;) {
+        pthread_mutex_lock(&q->lock);
+        if (!wk->core) q->failed = true;
+        while (!q->failed && q->nextChunk < q->chunkCount && q->nextChunk >= q->written + q->inFlight) {
+            pthread_cond_wait(&q->cond, &q->lock);
+        }
+        if (q->failed || q->nextChunk >= q->chunkCount) {
+            pthread_cond_broadcast(&q->cond);
+            pthread_mutex_unlock(&q->lock);
+            break;
+        }
+        int chunk = q->nextChunk++;
+        pthread_mutex_unlock(&q->lock);
+
+        int slot = chunk % q->inFlight;
+        bool ok = render_chunk(q, wk->core, chunk, q->buffers + chunkBytes * (size_t)slot);
+
+        pthread_mutex_lock(&q->lock);
+        if (ok) q->slotChunk[slot] = chunk;
+        else q->failed = true;
+        pthread_cond_broadcast(&q->cond);
+        pthread_mutex_unlock(&q->lock);
+    }
+    return NULL;
+}
+
+/* Workers render chunks in parallel; this thread hands them to the sink strictly in order. */
+static bool render_parallel(dlrl_RenderQueue* q, const dlrl_FrameSink* sink, dlrl_RenderWorker* workers,
+                            pthread_t* threads, int threadCount)
+{
+    size_t chunkBytes = render_frame_bytes(q) * (size_t)q->chunkFrames;
+    pthread_mutex_init(&q->lock, NULL);
+    pthread_cond_init(&q->cond, NULL);
+    int started = 0;
+    for (; started < threadCount; ++started) {
+        if (pthread_create(&threads[started], NULL, render_worker, &workers[started]) != 0) break;
+    }
+    if (started == 0) q->failed = true;
+
+    for (int chunk = 0; chunk < q->chunkCount; ++chunk) {
+        int slot = chunk % q->inFlight;
+        pthread_mutex_lock(&q->lock);
+        while (!q->failed && q->slotChunk[slot] != chunk) pthread_cond_wait(&q->cond, &q->lock);
+        bool failed = q->failed;
+        pthread_mutex_unlock(&q->lock);
+        if (failed) break;
+
+        bool ok = write_chunk(q, sink, chunk, q->buffers + chunkBytes * (size_t)slot);
+
+        pthread_mutex_lock(&q->lock);
+        q->slotChunk[slot] = -1;
+        q->written++;
+        if (!ok) q->failed = true;
+        pthread_cond_broadcast(&q->cond);
+        pthread_mutex_unlock(&q->lock);
+        if (!ok) break;
+    }
+
+    for (int i = 0; i < started; ++i) pthread_join(threads[i], NULL);
+    pthread_cond_destroy(&q->cond);
+    pthread_mutex_destroy(&q->lock);
+    return !q->failed && q->written == q->chunkCount;
+}
+#endif
+
+bool dlrl_RenderToSink(const dlrl_RenderJob* job, const dlrl_FrameSink* sink)
+{
+    if (!sink || !sink->frame) return false;
+    if (!job || !job->path) {
+        if (sink->end) sink->end(sink->user, false);
+        return false;
+    }
+
+    settle_fonts(true);
+    dlrl_RenderQueue q = { .job = job };
+    unsigned char* blob = NULL;
+    if (ends_with_ci(job->path, ".lottie")) {
+        if (!read_binary_file(job->path, &blob, &q.sourceSize)) {
+            if (sink->end) sink->end(sink->user, false);
+            return false;
+        }
+        q.kind = DLRL_SOURCE_DOTLOTTIE;
+        q.source = blob;
+    } else {
+        q.kind = DLRL_SOURCE_PATH;
+        q.source = (const unsigned char*)job->path;
+        q.sourceSize = strlen(job->path);
+    }
+
+    dlrl_CoreInfo info;
+    struct DotLottiePlayer* probe = open_render_core(&q, &info);
+    bool ok = (probe != NULL) && info.duration > 0.f && info.totalFrames > 0.f;
+    if (ok) {
+        q.w = info.w;
+        q.h = info.h;
+        q.duration = info.duration;
+        q.totalFrames = (int)info.totalFrames;
+        q.fps = (job->fps > 0.0) ? job->fps : 30.0;
+        q.start = (job->start_seconds > 0.0) ? job->start_seconds : 0.0;
+        double span = (job->duration_seconds > 0.0) ? job->duration_seconds : (double)info.duration - q.start;
+        q.frameCount = (span > 0.0) ? (int)ceil(span * q.fps - 1e-9) : 0;
+        q.chunkFrames = (job->chunk_frames > 0) ? job->chunk_frames : 30;
+        q.chunkCount = (q.frameCount + q.chunkFrames - 1) / q.chunkFrames;
+        ok = q.frameCount > 0;
+    }
+
+    int threadCount = (job->threads > 0) ? job->threads : 4;
+#if !defined(DLRL_HAVE_PTHREADS)
+    threadCount = 1;
+#endif
+    if (threadCount > q.chunkCount) threadCount = q.chunkCount > 0 ? q.chunkCount : 1;
+    q.inFlight = (job->max_chunks_in_flight > 0) ? job->max_chunks_in_flight : threadCount * 2;
+    if (threadCount == 1) q.inFlight = 1;
+
+    if (ok) {
+        size_t total = render_frame_bytes(&q) * (size_t)q.chunkFrames * (size_t)q.inFlight;
+        q.buffers = (total <= 0xFFFFFFFFu) ? (unsigned char*)MemAlloc((unsigned int)total) : NULL;
+        q.slotChunk = (int*)MemAlloc((unsigned int)(sizeof(int) * (size_t)q.inFlight));
+        ok = q.buffers && q.slotChunk;
+        for (int i = 0; ok && i < q.inFlight; ++i) q.slotChunk[i] = -1;
+    }
+    if (ok && sink->begin) ok = sink->begin(sink->user, (int)q.w, (int)q.h, q.fps, q.frameCount);
+
+    if (ok && threadCount == 1) {
+        for (int chunk = 0; ok && chunk < q.chunkCount; ++chunk) {
+            ok = render_chunk(&q, probe, chunk, q.buffers) && write_chunk(&q, sink, chunk, q.buffers);
+        }
+    }
+#if defined(DLRL_HAVE_PTHREADS)
+    else if (ok) {
+        dlrl_RenderWorker* workers = (dlrl_RenderWorker*)MemAlloc((unsigned int)(sizeof(dlrl_RenderWorker) * (size_t)threadCount));
+        pthread_t* threads = (pthread_t*)MemAlloc((unsigned int)(sizeof(pthread_t) * (size_t)threadCount));
+        ok = workers && threads;
+        if (ok) {
+            for (int i = 0; i < threadCount; ++i) workers[i] = (dlrl_RenderWorker){ .q = &q };
+            workers[0].core = probe;   /* the probe core serves the first worker */
+            probe = NULL;
+            ok = render_parallel(&q, sink, workers, threads, threadCount);
+            for (int i = 0; i < threadCount; ++i) {
+                if (workers[i].core) dotlottie_destroy(workers[i].core);
+            }
+        }
+        if (workers) MemFree(workers);
+        if (threads) MemFree(threads);
+    }
+#endif
+
+    if (sink->end) sink->end(sink->user, ok);
+    if (probe) dotlottie_destroy(probe);
+    if (q.buffers) MemFree(q.buffers);
+    if (q.slotChunk) MemFree(q.slotChunk);
+    if (blob) MemFree(blob);
+    return ok;
+}
+
+/* ---- Stream sink: Y4M or raw RGBA to a file descriptor ---- */
+
+typedef struct {
+    int fd;
+    dlrl_StreamFormat format;
+    int w, h;
+    unsigned char* planes;   /* Y4M: Y, Cb, Cr at full resolution (C444) */
+} dlrl_StreamState;
+
+static bool write_all(int fd, const void* data, size_t size)
+{
+    const unsigned char* p = (const unsigned char*)data;
+    while (size > 0) {
+#if defined(_WIN32)
+        int n = _write(fd, p, (unsigned int)(size > 0x40000000u ? 0x40000000u : size));
+#else
+        ssize_t n = write(fd, p, size);
+        if (n < 0 && errno == EINTR) continue;
+#endif
+        if (n <= 0) return false;
+        p += n;
+        size -= (size_t)n;
+    }
+    return true;
+}
+
+static bool stream_begin(void* user, int width, int height, double fps, int frame_count)
+{
+    (void)frame_count;
+    dlrl_StreamState* s = (dlrl_StreamState*)user;
+    s->w = width;
+    s->h = height;
+    if (s->format != DLRL_STREAM_Y4M) return true;
+    s->planes = (unsigned char*)MemAlloc((unsigned int)((size_t)width * (size_t)height * 3u));
+    if (!s->planes) return false;
+    char header[96];
+    int len = snprintf(header, sizeof(header), "YUV4MPEG2 W%d H%d F%ld:1000 Ip A1:1 C444\n",
+                       width, height, (long)floor(fps * 1000.0 + 0.5));
+    return len > 0 && write_all(s->fd, header, (size_t)len);
+}
+
+/* BT.601 studio range; transparent pixels are composited over black. */
+static bool stream_frame(void* user, const unsigned char* rgba, int index)
+{
+    (void)index;
+    dlrl_StreamState* s = (dlrl_StreamState*)user;
+    size_t n = (size_t)s->w * (size_t)s->h;
+    if (s->format != DLRL_STREAM_Y4M) return write_all(s->fd, rgba, n * 4u);
+
+    unsigned char* py = s->planes;
+    unsigned char* pu = py + n;
+    unsigned char* pv = pu + n;
+    for (size_t i = 0; i < n; ++i, rgba += 4) {
+        int a = rgba[3];
+        int r = (int)mul_div255(rgba[0], (uint32_t)a);
+        int g = (int)mul_div255(rgba[1], (uint32_t)a);
+        int b = (int)mul_div255(rgba[2], (uint32_t)a);
+        py[i] = (unsigned char)(((66 * r + 129 * g + 25 * b + 128) >> 8) + 16);
+        pu[i] = (unsigned char)(((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128);
+        pv[i] = (unsigned char)(((112 * r - 94 * g - 18 * b + 128) >> 8) + 128);
+    }
+    return write_all(s->fd, "FRAME\n", 6) && write_all(s->fd, s->planes, n * 3u);
+}
+
+static void stream_end(void* user, bool ok)
+{
+    (void)ok;
+    dlrl_StreamState* s = (dlrl_StreamState*)user;
+    if (s->planes) MemFree(s->planes);
+    MemFree(s);
+}
+
+dlrl_FrameSink dlrl_StreamSink(int fd, dlrl_StreamFormat format)
+{
+    dlrl_StreamState* s = (dlrl_StreamState*)MemAlloc(sizeof(dlrl_StreamState));
+    if (!s) return (dlrl_FrameSink){0};
+    s->fd = fd;
+    s->format = format;
+    return (dlrl_FrameSink){ .user = s, .begin = stream_begin, .frame = stream_frame, .end = stream_end };
+}
+
+bool dlrl_RegisterFont(const char* name, const void* data, size_t size)
+{
+    if (!name || !name[0] || !data || size == 0) return false;
+    settle_font_name(name);
+    uint64_t hash = hash64(14695981039346656037ull, data, size);
+    lock_fonts();
+    int i = find_font(name);
+    if (i >= 0 && g_fonts.fonts[i].blob >= 0 && g_fonts.fonts[i].state != DLRL_FONT_FAILED) {
+        const dlrl_FontBlob* b = &g_fonts.blobs[g_fonts.fonts[i].blob];
+        if (b->hash == hash && b->size == size && memcmp(b->data, data, size) == 0) {
+            unlock_fonts();
+            return true;
+        }
+    }
+    unsigned char* copy = (unsigned char*)MemAlloc((unsigned int)size);
+    int blob = -1;
+    if (copy) {
+        memcpy(copy, data, size);
+        blob = share_blob(copy, size, false, hash);
+        if (blob < 0) MemFree(copy);
+    }
+    if (blob >= 0 && i < 0) i = add_font(name);
+    if (blob < 0 || i < 0) {
+        unlock_fonts();
+        return false;
+    }
+    dlrl_FontEntry* e = &g_fonts.fonts[i];
+    if (e->path) MemFree(e->path);
+    e->path = NULL;
+    e->blob = blob;
+    e->state = DLRL_FONT_LOADED;
+    unlock_fonts();
+    settle_fonts(false);
+    lock_fonts();
+    bool ok = g_fonts.fonts[i].state == DLRL_FONT_READY;
+    unlock_fonts();
+    return ok;
+}
+
+bool dlrl_RegisterFontFile(const char* name, const char* path, bool background)
+{
+    if (!name || !name[0] || !path || !path[0]) return false;
+    settle_font_name(name);
+    lock_fonts();
+    int i = find_font(name);
+    if (i >= 0 && g_fonts.fonts[i].path && strcmp(g_fonts.fonts[i].path, path) == 0 &&
+            g_fonts.fonts[i].state != DLRL_FONT_FAILED) {
+        unlock_fonts();
+        return true;
+    }
+    size_t len = strlen(path);
+    char* pathCopy = (char*)MemAlloc((unsigned int)(len + 1));
+    if (pathCopy) memcpy(pathCopy, path, len + 1);
+    if (pathCopy && i < 0) i = add_font(name);
+    if (!pathCopy || i < 0) {
+        if (pathCopy) MemFree(pathCopy);
+        unlock_fonts();
+        return false;
+    }
+    dlrl_FontEntry* e = &g_fonts.fonts[i];
+    if (e->path) MemFree(e->path);
+    e->path = pathCopy;
+    e->blob = -1;
+
+#if defined(DLRL_HAVE_PTHREADS)
+    if (background) {
+        if (!g_fonts.threadRunning) {
+            g_fonts.threadRunning = (pthread_create(&g_fonts.thread, NULL, font_loader, NULL) == 0);
+        }
+        if (g_fonts.threadRunning) {
+            e->state = DLRL_FONT_QUEUED;
+            g_fonts.pending++;
+            pthread_cond_broadcast(&g_fonts.cond);
+            unlock_fonts();
+            return true;
+        }
+    }
+#else
+    (void)background;
+#endif
+    e->state = DLRL_FONT_LOADING;
+    unlock_fonts();
+
+    int blob = load_font_file(path);
+
+    lock_fonts();
+    g_fonts.fonts[i].blob = blob;
+    g_fonts.fonts[i].state = (blob >= 0) ? DLRL_FONT_LOADED : DLRL_FONT_FAILED;
+    unlock_fonts();
+    settle_fonts(false);
+    lock_fonts();
+    bool ok = g_fonts.fonts[i].state == DLRL_FONT_READY;
+    unlock_fonts();
+    return ok;
+}
+
+/* ---- Layer bounds and hit testing ---- */
+
+static dlrl_LayerCache* find_layer_cache(const dlrl_Player* p, const char* name)
+{
+    for (int i = 0; i < p->layerCount; ++i) {
+        if (strcmp(p->layerCache[i].name, name) == 0) return &p->layerCache[i];
+    }
+    return NULL;
+}
+
+static dlrl_LayerCache* add_layer_cache(dlrl_Player* p, const char* name, bool hit)
+{
+    if (p->layerCount == p->layerCap) {
+        int cap = p->layerCap ? p->layerCap * 2 : 4;
+        dlrl_LayerCache* grown = (dlrl_LayerCache*)MemRealloc(p->layerCache, (unsigned int)(sizeof(dlrl_LayerCache) * (size_t)cap));
+        if (!grown) return NULL;
+        p->layerCache = grown;
+        p->layerCap = cap;
+    }
+    dlrl_LayerCache* e = &p->layerCache[p->layerCount++];
+    *e = (dlrl_LayerCache){ .hit = hit };
+    copy_capped(e->name, sizeof(e->name), name);
+    return e;
+}
+
+/* Runtime bounds in surface pixels, queried at most once per rendered frame. */
+static bool layer_surface_bounds(dlrl_Player* p, dlrl_LayerCache* e)
+{
+    if (e->cached && e->frame == p->coreFrame && e->content == p->contentSerial) return e->valid;
+    e->cached = true;
+    e->frame = p->coreFrame;
+    e->content = p->contentSerial;
+    e->valid = !p->evicted && dotlottie_layer_bounds(p->core, e->name, &e->box) == DOTLOTTIE_SUCCESS;
+    return e->valid;
+}
+
+/* Surface point to screen through the fit rect and rotation of the last dlrl_Draw. */
+static Vector2 surface_to_screen(const dlrl_Player* p, float sx, float sy)
+{
+    const Rectangle f = p->drawFit;
+    float hw = f.width * 0.5f, hh = f.height * 0.5f;
+    float lx = sx * f.width / (float)p->texW - hw;
+    float ly = sy * f.height / (float)p->texH - hh;
+    float r = p->drawRotation * (PI / 180.f);
+    float c = cosf(r), s = sinf(r);
+    return (Vector2){ f.x + hw + lx * c - ly * s, f.y + hh + lx * s + ly * c };
+}
+
+static bool layer_screen_quad(dlrl_Player* p, dlrl_LayerCache* e, Vector2 quad[4])
+{
+    if (!p->drawn || !layer_surface_bounds(p, e)) return false;
+    quad[0] = surface_to_screen(p, e->box.x1, e->box.y1);
+    quad[1] = surface_to_screen(p, e->box.x2, e->box.y2);
+    quad[2] = surface_to_screen(p, e->box.x3, e->box.y3);
+    quad[3] = surface_to_screen(p, e->box.x4, e->box.y4);
+    return true;
+}
+
+/* Convex quad test that accepts either winding. */
+static bool quad_contains(const Vector2 q[4], Vector2 pt)
+{
+    bool pos = false, neg = false;
+    for (int i = 0; i < 4; ++i) {
+        Vector2 a = q[i], b = q[(i + 1) & 3];
+        float cross = (b.x - a.x) * (pt.y - a.y) - (b.y - a.y) * (pt.x - a.x);
+        if (cross > 0.f) pos = true;
+        if (cross < 0.f) neg = true;
+        if (pos && neg) return false;
+    }
+    return true;
+}
+
+static Rectangle draw_aabb(const dlrl_Player* p)
+{
+    Vector2 c[4] = {
+        surface_to_screen(p, 0.f, 0.f), surface_to_screen(p, (float)p->texW, 0.f),
+        surface_to_screen(p, (float)p->texW, (float)p->texH), surface_to_screen(p, 0.f, (float)p->texH)
+    };
+    float x0 = c[0].x, y0 = c[0].y, x1 = c[0].x, y1 = c[0].y;
+    for (int i = 1; i < 4; ++i) {
+        x0 = fminf(x0, c[i].x); y0 = fminf(y0, c[i].y);
+        x1 = fmaxf(x1, c[i].x); y1 = fmaxf(y1, c[i].y);
+    }
+    return (Rectangle){ x0, y0, x1 - x0, y1 - y0 };
+}
+
+static int grid_cell_x(float x)
+{
+    int cx = (int)((x - g_dlrl.grid.x0) / g_dlrl.grid.cellW);
+    return cx < 0 ? 0 : (cx >= g_dlrl.grid.cols ? g_dlrl.grid.cols - 1 : cx);
+}
+
+static int grid_cell_y(float y)
+{
+    int cy = (int)((y - g_dlrl.grid.y0) / g_dlrl.grid.cellH);
+    return cy < 0 ? 0 : (cy >= g_dlrl.grid.rows ? g_dlrl.grid.rows - 1 : cy);
+}
+
+/* Drawn with dlrl_Draw since the dlrl_HitTest before the latest draws, i.e. in the current frame. */
+static bool hit_live(const dlrl_Player* p)
+{
+    return p->drawn && p->hitLayers > 0 && p->drawnAt > g_dlrl.grid.frameStart;
+}
+
+/* Uniform grid over the screen rects of live players with hit layers, rebuilt when one moves,
+ * appears or stops being drawn. A failed build leaves builtEpoch stale so the next query retries. */
+static void build_hit_grid(void)
+{
+    dlrl_HitGrid* g = &g_dlrl.grid;
+    g->count = 0;
+    float x0 = 0.f, y0 = 0.f, x1 = 0.f, y1 = 0.f;
+    int n = 0;
+    for (dlrl_Player* it = g_dlrl.players; it; it = it->next) {
+        it->hitIndexed = false;
+        if (!hit_live(it)) continue;
+        Rectangle r = draw_aabb(it);
+        it->drawAabb = r;
+        if (n == 0) { x0 = r.x; y0 = r.y; x1 = r.x + r.width; y1 = r.y + r.height; }
+        x0 = fminf(x0, r.x); y0 = fminf(y0, r.y);
+        x1 = fmaxf(x1, r.x + r.width); y1 = fmaxf(y1, r.y + r.height);
+        ++n;
+    }
+    if (n == 0) {
+        g->builtEpoch = g_dlrl.hitEpoch;
+        return;
+    }
+
+    int side = (int)ceilf(sqrtf((float)n));
+    if (side > DLRL_HIT_GRID_MAX) side = DLRL_HIT_GRID_MAX;
+    g->cols = g->rows = side;
+    g->x0 = x0;
+    g->y0 = y0;
+    g->x1 = x1;
+    g->y1 = y1;
+    g->cellW = fmaxf((x1 - x0) / (float)side, 1.f);
+    g->cellH = fmaxf((y1 - y0) / (float)side, 1.f);
+
+    int cells = side * side;
+    for (int pass = 0; pass < 2; ++pass) {
+        if (pass == 1) {
+            /* Prefix sums turn per-cell counts into start offsets. */
+            int total = 0;
+            for (int c = 0; c <= cells; ++c) {
+                int k = g->cellStart[c];
+                g->cellStart[c] = total;
+                total += k;
+            }
+            if (total > g->itemCap) {
+                dlrl_Player** grown = (dlrl_Player**)MemRealloc(g->items, (unsigned int)(sizeof(dlrl_Player*) * (size_t)total));
+                if (!grown) return;
+                g->items = grown;
+                g->itemCap = total;
+            }
+            memset(g->cellFill, 0, sizeof(int) * (size_t)cells);
+        } else {
+            memset(g->cellStart, 0, sizeof(int) * (size_t)(cells + 1));
+        }
+        for (dlrl_Player* it = g_dlrl.players; it; it = it->next) {
+            if (!hit_live(it)) continue;
+            if (pass == 1) it->hitIndexed = true;
+            Rectangle r = it->drawAabb;
+            int cx0 = grid_cell_x(r.x), cx1 = grid_cell_x(r.x + r.width);
+            int cy0 = grid_cell_y(r.y), cy1 = grid_cell_y(r.y + r.height);
+            for (int cy = cy0; cy <= cy1; ++cy) {
+                for (int cx = cx0; cx <= cx1; ++cx) {
+                    int c = cy * side + cx;
+                    if (pass == 0) g->cellStart[c]++;
+                    else g->items[g->cellStart[c] + g->cellFill[c]++] = it;
+                }
+            }
+        }
+    }
+    g->count = n;
+    g->builtEpoch = g_dlrl.hitEpoch;
+}
+
+bool dlrl_LayerBounds(dlrl_Player* p, const char* layer_name, Vector2 corners[4])
+{
+    if (!p || !layer_name || !layer_name[0] || !corners) return false;
+    dlrl_LayerCache* e = find_layer_cache(p, layer_name);
+    if (!e) e = add_layer_cache(p, layer_name, false);
+    return e && layer_screen_quad(p, e, corners);
+}
+
+bool dlrl_AddHitLayer(dlrl_Player* p, const char* layer_name)
+{
+    if (!p || !layer_name || !layer_name[0]) return false;
+    dlrl_LayerCache* e = find_layer_cache(p, layer_name);
+    if (!e) e = add_layer_cache(p, layer_name, true);
+    if (!e) return false;
+    e->hit = true;
+    p->hitLayers = 0;
+    for (int i = 0; i < p->layerCount; ++i) p->hitLayers += p->layerCache[i].hit ? 1 : 0;
+    g_dlrl.hitEpoch++;
+    return true;
+}
+
+void dlrl_ClearHitLayers(dlrl_Player* p)
+{
+    if (!p) return;
+    for (int i = 0; i < p->layerCount; ++i) p->layerCache[i].hit = false;
+    if (p->hitLayers > 0) g_dlrl.hitEpoch++;
+    p->hitLayers = 0;
+}
+
+bool dlrl_HitTest(Vector2 point, dlrl_Hit* out)
+{
+    dlrl_HitGrid* g = &g_dlrl.grid;
+    if (g_dlrl.drawCounter != g->seenCounter) {
+        /* Draws happened since the last query: a new frame. Players it skipped drop out. */
+        g->frameStart = g->seenCounter;
+        g->seenCounter = g_dlrl.drawCounter;
+        for (dlrl_Player* it = g_dlrl.players; it; it = it->next) {
+            if (hit_live(it) != it->hitIndexed) {
+                g_dlrl.hitEpoch++;
+                break;
+            }
+        }
+    }
+    if (g->builtEpoch != g_dlrl.hitEpoch) build_hit_grid();
+    if (g->count == 0 || point.x < g->x0 || point.y < g->y0 || point.x > g->x1 || point.y > g->y1) return false;
+
+    int c = grid_cell_y(point.y) * g->cols + grid_cell_x(point.x);
+    dlrl_Player* best = NULL;
+    const char* bestLayer = NULL;
+    for (int i = g->cellStart[c]; i < g->cellStart[c + 1]; ++i) {
+        dlrl_Player* p = g->items[i];
+        Rectangle r = p->drawAabb;
+        if (p->evicted || (best && p->drawStamp < best->drawStamp)) continue;
+        if (point.x < r.x || point.y < r.y || point.x > r.x + r.width || point.y > r.y + r.height) continue;
+        for (int k = 0; k < p->layerCount; ++k) {
+            dlrl_LayerCache* e = &p->layerCache[k];
+            Vector2 quad[4];
+            if (!e->hit || !layer_screen_quad(p, e, quad) || !quad_contains(quad, point)) continue;
+            best = p;
+            bestLayer = e->name;
+            break;
+        }
+    }
+    if (!best) return false;
+    if (out) *out = (dlrl_Hit){ .player = best, .layer = bestLayer };
+    return true;
+}
+
+dlrl_AllocStats dlrl_GetAllocStats(void)
+{
+#if defined(DLRL_TRACK_ALLOCS)
+#if defined(DLRL_HAVE_PTHREADS)
+    pthread_mutex_lock(&g_track.lock);
+#endif
+    dlrl_AllocStats out = {
+        .tracking = true,
+        .live_bytes = g_track.liveBytes,
+        .peak_bytes = g_track.peakBytes,
+        .live_allocations = g_track.liveAllocations,
+        .total_allocations = g_track.totalAllocations,
+        .live_textures = g_track.liveTextures,
+        .texture_bytes = g_track.textureBytes
+    };
+#if defined(DLRL_HAVE_PTHREADS)
+    pthread_mutex_unlock(&g_track.lock);
+#endif
+    return out;
+#else
+    return (dlrl_AllocStats){0};
+#endif
 }
@@ -21,6 +21,24 @@ extern "C" {
 /** @brief Opaque animation player instance. */
 typedef struct dlrl_Player dlrl_Player;
 
+/** @brief Opaque CPU compositor that merges many players into one texture. */
+typedef struct dlrl_Canvas dlrl_Canvas;
+
+/** @brief Opaque marker reference from dlrl_FindMarker; goes stale when the animation changes. */
+typedef int dlrl_MarkerHandle;
+
+/** @brief Handle meaning "no marker": plays the full timeline. */
+#define DLRL_NO_MARKER (-1)
+
+/** @brief Interned, reference-counted theme (bundle theme id or inline theme JSON). */
+typedef int dlrl_ThemeHandle;
+
+/** @brief Handle for the animation's own colors (no theme applied). */
+#define DLRL_DEFAULT_THEME 0
+
+/** @brief Returned by dlrl_ThemeFromId/dlrl_ThemeFromData when the theme cannot be stored. */
+#define DLRL_INVALID_THEME (-1)
+
 /** @brief How the animation fits the destination rectangle. */
 typedef enum {
     DLRL_FIT_CONTAIN,
@@ -54,8 +72,124 @@ typedef struct {
     const char* theme_id;           /**< Optional theme id from the bundle; NULL for default. */
     const char* state_machine_id;   /**< Optional state machine id; NULL to ignore. */
     const char* marker;             /**< Optional marker label to start from; NULL plays whole clip. */
+    bool        frame_cache;        /**< Serve whole frames from the disk cache configured in dlrl_InitEx. */
 } dlrl_Config;
 
+/** @brief Pixel encoding of baked sprite sheets. */
+typedef enum {
+    DLRL_BAKE_RGBA8,                /**< Uncompressed, 4 bytes per pixel. */
+    DLRL_BAKE_DXT1,                 /**< BC1, 0.5 bytes per pixel, 1-bit alpha. */
+    DLRL_BAKE_DXT5                  /**< BC3, 1 byte per pixel, interpolated alpha. */
+} dlrl_BakeFormat;
+
+/** @brief Precomputed segment of one marker. */
+typedef struct {
+    const char* name;               /**< Marker label; owned by the player. */
+    float       start_frame;        /**< First frame of the segment. */
+    float       frame_count;        /**< Frames in the segment. */
+    float       duration;           /**< Segment duration in seconds. */
+} dlrl_MarkerInfo;
+
+/** @brief What the last dlrl_Update did to the timeline. */
+typedef struct {
+    int    loops;                   /**< Loop boundaries crossed; bounce modes count full out-and-back cycles. */
+    bool   completed;               /**< A non-looping segment reached its end during this update. */
+    int    steps;                   /**< Fixed steps consumed; 0 when fixed stepping is off. */
+    double time;                    /**< Position inside the segment after the update, in seconds. */
+} dlrl_StepInfo;
+
+/** @brief Global settings passed to dlrl_InitEx. */
+typedef struct {
+    size_t gpu_budget_bytes;        /**< Cap on player texture bytes; 0 means unlimited. */
+    size_t cpu_budget_bytes;        /**< Cap on CPU pixel-buffer bytes; 0 means unlimited. */
+    const int* texture_buckets;     /**< Optional texture edge sizes; NULL uses powers of two from 64. */
+    int    texture_bucket_count;    /**< Entries in texture_buckets. */
+    int    pool_max_textures;       /**< Idle textures kept for reuse; 0 uses 8, capped at 64. */
+    float  resize_settle_seconds;   /**< Quiet period before dlrl_Resize reallocates; 0 applies on the next update. */
+    const char* cache_dir;          /**< Directory for baked-frame cache files; NULL disables the cache. */
+    size_t cache_max_bytes;         /**< Cap on the cache directory; oldest files go first. 0 means unlimited. */
+} dlrl_InitOptions;
+
+/** @brief One player placed on a canvas. */
+typedef struct {
+    dlrl_Player* player;
+    Rectangle    dest;              /**< Canvas-space rectangle; the player's fit/align place the frame inside. */
+    Color        tint;              /**< Multiplied into the frame before compositing. */
+} dlrl_CanvasLayer;
+
+/** @brief Receives rendered frames in order; see dlrl_RenderToSink. */
+typedef struct {
+    void* user;                     /**< Passed back to every callback. */
+    bool (*begin)(void* user, int width, int height, double fps, int frame_count); /**< Optional; false aborts. */
+    bool (*frame)(void* user, const unsigned char* rgba, int index); /**< Straight-alpha RGBA8, width*height*4 bytes; false aborts. */
+    void (*end)(void* user, bool ok); /**< Optional; always called exactly once. */
+} dlrl_FrameSink;
+
+/** @brief Byte stream written by dlrl_StreamSink. */
+typedef enum {
+    DLRL_STREAM_Y4M,                /**< YUV4MPEG2, 4:4:4, BT.601; alpha composited over black. */
+    DLRL_STREAM_RGBA                /**< Headerless RGBA8 frames back to back. */
+} dlrl_StreamFormat;
+
+/** @brief Headless render of one asset at a fixed frame rate and resolution. */
+typedef struct {
+    const char* path;               /**< .lottie bundle or Lottie JSON file. */
+    const dlrl_Config* config;      /**< width/height set the output size (0 = natural); animation_id, theme_id, background apply. NULL for defaults. */
+    double fps;                     /**< Output frame rate; 0 means 30. */
+    double start_seconds;           /**< Asset time of the first output frame. */
+    double duration_seconds;        /**< Length to render; 0 renders to the end of the animation. */
+    int    threads;                 /**< Parallel player instances; 0 means 4, 1 renders on the calling thread. */
+    int    chunk_frames;            /**< Consecutive frames rendered by one instance at a time; 0 means 30. */
+    int    max_chunks_in_flight;    /**< Rendered chunks buffered ahead of the sink; 0 means 2 * threads. */
+} dlrl_RenderJob;
+
+/** @brief Result of dlrl_HitTest. */
+typedef struct {
+    dlrl_Player* player;            /**< Topmost (most recently drawn) player hit. */
+    const char*  layer;             /**< Its registered layer under the point; valid until the player is unloaded. */
+} dlrl_Hit;
+
+/** @brief Allocation and texture counters of a DLRL_TRACK_ALLOCS build. */
+typedef struct {
+    bool     tracking;              /**< false when dlrl.c was built without DLRL_TRACK_ALLOCS. */
+    size_t   live_bytes;            /**< Bytes currently held through MemAlloc/MemRealloc. */
+    size_t   peak_bytes;            /**< Highest live_bytes seen. */
+    size_t   live_allocations;      /**< Blocks currently held. */
+    uint64_t total_allocations;     /**< Blocks ever allocated. */
+    int      live_textures;         /**< Textures loaded and not yet unloaded, pooled ones included. */
+    size_t   texture_bytes;         /**< Their size in bytes. */
+} dlrl_AllocStats;
+
+/** @brief Disk frame-cache counters for one player. */
+typedef struct {
+    int    hits;                    /**< Frames decoded from the cache. */
+    int    misses;                  /**< Frames rendered because the cache lacked them. */
+    int    frames_on_disk;          /**< Frames present in the mapped cache file. */
+    int    frames_pending;          /**< Rendered frames waiting for the next flush. */
+    size_t file_bytes;              /**< Size of the mapped cache file. */
+} dlrl_CacheStats;
+
+/** @brief Current memory usage against the budgets set in dlrl_InitEx. */
+typedef struct {
+    size_t gpu_bytes;               /**< Texture bytes held by live players. */
+    size_t cpu_bytes;               /**< Pixel-buffer bytes held by live players. */
+    size_t gpu_budget_bytes;        /**< Configured texture budget; 0 means unlimited. */
+    size_t cpu_budget_bytes;        /**< Configured pixel-buffer budget; 0 means unlimited. */
+    int    players;                 /**< Live players. */
+    int    evicted_players;         /**< Players whose buffers are currently released. */
+} dlrl_MemoryUsage;
+
+/** @brief Counters for speculative warm-up; hit rate is hits / (hits + misses). */
+typedef struct {
+    int marker_hits;        /**< dlrl_SetMarker calls served from a warm slot. */
+    int marker_misses;      /**< dlrl_SetMarker calls that rendered cold. */
+    int animation_hits;     /**< dlrl_SetAnimation calls that swapped in a warm core. */
+    int animation_misses;   /**< dlrl_SetAnimation calls that loaded cold. */
+    int frames_warmed;      /**< Frames pre-rendered in the background. */
+    int frames_served;      /**< Updates that uploaded a held frame instead of rendering. */
+    int wasted;             /**< Warm entries dropped without ever being used. */
+} dlrl_WarmStats;
+
 /**
  * @brief Initialize global state.
  * @return true on success.
@@ -63,7 +197,23 @@ typedef struct {
 bool dlrl_Init(void);
 
 /**
- * @brief Tear down global state; reserved for future cleanup.
+ * @brief Initialize global state with memory budgets.
+ *
+ * When a budget is exceeded, the least recently drawn players release their texture and
+ * pixel buffers; the next dlrl_Update or dlrl_Draw on them rebuilds both transparently.
+ * @param opts Budget settings; NULL disables the budgets.
+ * @return true on success.
+ */
+bool dlrl_InitEx(const dlrl_InitOptions* opts);
+
+/**
+ * @brief Tear down global state.
+ *
+ * Stops the background font loader (dropping queued loads) and frees every registered font,
+ * the idle texture pool, all interned themes and the hit-test grid, and forgets the budgets
+ * and cache directory from dlrl_InitEx. Font registrations and theme handles do not survive:
+ * register fonts and intern themes again after the next dlrl_Init. Unload players and
+ * canvases first, and call it from the thread that owns the GL context.
  */
 void dlrl_Shutdown(void);
 
@@ -136,21 +286,55 @@ void dlrl_SetLoop(dlrl_Player* p, bool loop);
  */
 void dlrl_SetMode(dlrl_Player* p, dlrl_Mode mode);
 
+/**
+ * @brief Advance in whole fixed steps instead of by the raw delta.
+ *
+ * dlrl_Update accumulates real time and consumes it in multiples of the step, so equal
+ * input sequences give bit-identical playback (replays, lockstep simulation).
+ * @param p Player instance.
+ * @param step_seconds Step length in seconds; 0 returns to variable stepping.
+ */
+void dlrl_SetFixedStep(dlrl_Player* p, double step_seconds);
+
+/**
+ * @brief Loops, completion and steps taken by the most recent dlrl_Update.
+ * @param p Player instance.
+ * @return Step report.
+ */
+dlrl_StepInfo dlrl_LastStep(const dlrl_Player* p);
+
 /**
  * @brief Advance the animation by the given delta time.
  * @param p Player instance.
- * @param dt_seconds Delta time in seconds; call once per frame.
+ * @param dt_seconds Delta time in seconds; call once per frame. Any size is handled in
+ *                   constant time, including long pauses and high speeds.
  */
 void dlrl_Update(dlrl_Player* p, float dt_seconds);
 
 /**
  * @brief Draw the current frame into a destination rectangle.
+ *
+ * Records the draw for budget eviction and hit testing, and rebuilds an evicted player first.
  * @param p Player instance.
  * @param dest Destination rectangle in screen space.
  * @param rotation Rotation angle in degrees.
  * @param tint Tint color applied to the quad.
  */
-void dlrl_Draw(const dlrl_Player* p, Rectangle dest, float rotation, Color tint);
+void dlrl_Draw(dlrl_Player* p, Rectangle dest, float rotation, Color tint);
+
+/**
+ * @brief Draw the current frame at many destinations in one batch.
+ *
+ * Backgrounds, when not fully transparent, are drawn first for all quads, then every
+ * frame quad is emitted into the same render batch. Like dlrl_Draw, it counts as a use for
+ * budget eviction and rebuilds an evicted player first.
+ * @param p Player instance.
+ * @param dests Destination rectangles in screen space.
+ * @param rotations Per-quad rotation in degrees, or NULL for none.
+ * @param tints Per-quad tint, or NULL for WHITE.
+ * @param n Number of quads.
+ */
+void dlrl_DrawMany(dlrl_Player* p, const Rectangle* dests, const float* rotations, const Color* tints, int n);
 
 /**
  * @brief Total duration in seconds of the active animation/segment.
@@ -189,11 +373,34 @@ Vector2 dlrl_NaturalSize(const dlrl_Player* p);
 
 /**
  * @brief Texture backing the currently rendered frame.
+ *
+ * Textures come from a shared pool rounded up to size buckets, so the texture may be larger
+ * than the frame; sample it with dlrl_GetSourceRect.
  * @param p Player instance.
  * @return Live texture; valid while the player lives.
  */
 Texture2D dlrl_GetTexture(const dlrl_Player* p);
 
+/**
+ * @brief Region of dlrl_GetTexture holding the current frame.
+ * @param p Player instance.
+ * @return Source rectangle in texels.
+ */
+Rectangle dlrl_GetSourceRect(const dlrl_Player* p);
+
+/**
+ * @brief Request a new output size.
+ *
+ * Requests are coalesced: the resize applies in dlrl_Update once no new request arrived for
+ * resize_settle_seconds, and reuses the current texture when the size bucket is unchanged.
+ * Warm-up slots are dropped when the size changes.
+ * @param p Player instance.
+ * @param width Output width in pixels; 0 uses the asset's width.
+ * @param height Output height in pixels; 0 uses the asset's height.
+ * @return true if the request was recorded.
+ */
+bool dlrl_Resize(dlrl_Player* p, int width, int height);
+
 /**
  * @brief Switch the active theme.
  * @param p Player instance.
@@ -202,6 +409,75 @@ Texture2D dlrl_GetTexture(const dlrl_Player* p);
  */
 bool dlrl_SetTheme(dlrl_Player* p, const char* theme_id);
 
+/**
+ * @brief Switch to a theme given as inline theme JSON.
+ * @param p Player instance.
+ * @param theme_json Theme document; NULL or empty for default.
+ * @return true on success.
+ */
+bool dlrl_SetThemeData(dlrl_Player* p, const char* theme_json);
+
+/**
+ * @brief Intern a bundle theme id; equal ids return the same handle.
+ *
+ * Every call adds a reference that the caller drops with dlrl_ReleaseTheme. Players and
+ * prepared variants hold their own references, so a handle may be released while in use.
+ * @param theme_id Theme identifier; NULL or empty gives DLRL_DEFAULT_THEME.
+ * @return Theme handle, or DLRL_INVALID_THEME when out of memory.
+ */
+dlrl_ThemeHandle dlrl_ThemeFromId(const char* theme_id);
+
+/**
+ * @brief Intern inline theme JSON (copied); equal documents return the same handle.
+ *
+ * Adds a reference like dlrl_ThemeFromId.
+ * @param theme_json Theme document; NULL or empty gives DLRL_DEFAULT_THEME.
+ * @return Theme handle, or DLRL_INVALID_THEME when out of memory.
+ */
+dlrl_ThemeHandle dlrl_ThemeFromData(const char* theme_json);
+
+/**
+ * @brief Drop a reference taken by dlrl_ThemeFromId or dlrl_ThemeFromData.
+ *
+ * When no caller, player or variant uses the theme any more its text is freed and the handle
+ * may be reused. Releasing DLRL_DEFAULT_THEME or an unknown handle does nothing.
+ * @param theme Theme handle.
+ */
+void dlrl_ReleaseTheme(dlrl_ThemeHandle theme);
+
+/**
+ * @brief Build a variant of the player with the theme already applied.
+ *
+ * The variant is a second core loaded from the player's retained source at the current size.
+ * Up to four are kept per player (least recently used is replaced); they count toward the CPU
+ * budget and are dropped on resize, eviction and dlrl_SetAnimation.
+ * @param p Player instance.
+ * @param theme Theme to prepare.
+ * @return true when a variant exists or the theme is already active.
+ */
+bool dlrl_PrepareTheme(dlrl_Player* p, dlrl_ThemeHandle theme);
+
+/**
+ * @brief Switch the active theme by handle.
+ *
+ * A prepared variant is swapped in without re-applying the theme, and the previous core is
+ * kept as the variant for the previous theme, so switching back is also a swap. Without a
+ * variant the theme is applied to the current core as dlrl_SetTheme does.
+ * @param p Player instance.
+ * @param theme Theme to activate.
+ * @return true on success.
+ */
+bool dlrl_UseTheme(dlrl_Player* p, dlrl_ThemeHandle theme);
+
+/**
+ * @brief Switch many players to the same theme.
+ * @param players Array of players; NULL entries are skipped.
+ * @param count Number of entries.
+ * @param theme Theme to activate.
+ * @return Number of players switched.
+ */
+int dlrl_UseThemeMany(dlrl_Player* const* players, int count, dlrl_ThemeHandle theme);
+
 /**
  * @brief Switch the active animation.
  * @param p Player instance.
@@ -218,6 +494,42 @@ bool dlrl_SetAnimation(dlrl_Player* p, const char* animation_id);
  */
 bool dlrl_SetMarker(dlrl_Player* p, const char* marker_name);
 
+/**
+ * @brief Look up a marker by label, ignoring case, through a hash index built at load.
+ * @param p Player instance.
+ * @param marker_name Marker label.
+ * @return Handle for dlrl_SetMarkerHandle, or DLRL_NO_MARKER when absent.
+ */
+dlrl_MarkerHandle dlrl_FindMarker(const dlrl_Player* p, const char* marker_name);
+
+/**
+ * @brief dlrl_FindMarker for a label that is not NUL-terminated.
+ * @param p Player instance.
+ * @param marker_name First character of the label.
+ * @param length Label length in bytes.
+ * @return Handle for dlrl_SetMarkerHandle, or DLRL_NO_MARKER when absent.
+ */
+dlrl_MarkerHandle dlrl_FindMarkerN(const dlrl_Player* p, const char* marker_name, size_t length);
+
+/**
+ * @brief Jump to a marker by handle in constant time.
+ * @param p Player instance.
+ * @param marker Handle from dlrl_FindMarker, or DLRL_NO_MARKER for the full timeline.
+ * @return true on success, false for a stale or out-of-range handle.
+ */
+bool dlrl_SetMarkerHandle(dlrl_Player* p, dlrl_MarkerHandle marker);
+
+/**
+ * @brief Copy the precomputed marker table, sorted by start frame.
+ *
+ * Entry i is the marker at index i, as reported by dlrl_MarkerName.
+ * @param p Player instance.
+ * @param out Destination array; may be NULL to query the count.
+ * @param capacity Entries available in out.
+ * @return Total number of markers.
+ */
+int dlrl_GetMarkers(const dlrl_Player* p, dlrl_MarkerInfo* out, int capacity);
+
 /**
  * @brief Number of markers embedded in the active animation.
  * @param p Player instance.
@@ -233,6 +545,272 @@ int dlrl_MarkerCount(const dlrl_Player* p);
  */
 const char* dlrl_MarkerName(const dlrl_Player* p, int index);
 
+/**
+ * @brief Report current texture and pixel-buffer usage against the configured budgets.
+ * @return Usage snapshot.
+ */
+dlrl_MemoryUsage dlrl_GetMemoryUsage(void);
+
+/**
+ * @brief Declare a marker as a likely next segment.
+ *
+ * Its first few frames are rendered during later dlrl_Update calls (one frame per update)
+ * and held, so dlrl_SetMarker on it shows a ready frame immediately. Up to four markers and
+ * animations are held per player; declaring more replaces the oldest.
+ * @param p Player instance.
+ * @param marker_name Marker label.
+ * @return true if the marker exists and is queued or already warm.
+ */
+bool dlrl_WarmMarker(dlrl_Player* p, const char* marker_name);
+
+/**
+ * @brief Declare an animation from the bundle as a likely next switch.
+ *
+ * A second core loads the animation in the background with its texture already sized;
+ * dlrl_SetAnimation on it swaps the core in without loading or reallocating.
+ * Only players loaded from a .lottie archive can warm animations.
+ * @param p Player instance.
+ * @param animation_id Animation identifier.
+ * @return true if queued or already warm.
+ */
+bool dlrl_WarmAnimation(dlrl_Player* p, const char* animation_id);
+
+/**
+ * @brief Drop every warm marker and animation held by the player.
+ * @param p Player instance.
+ */
+void dlrl_ClearWarm(dlrl_Player* p);
+
+/**
+ * @brief Warm-up hit/miss counters since load or the last reset.
+ * @param p Player instance.
+ * @return Counter snapshot.
+ */
+dlrl_WarmStats dlrl_GetWarmStats(const dlrl_Player* p);
+
+/**
+ * @brief Zero the warm-up counters.
+ * @param p Player instance.
+ */
+void dlrl_ResetWarmStats(dlrl_Player* p);
+
+/**
+ * @brief Rasterize every frame of a segment into GPU sprite sheets.
+ *
+ * While the baked segment is active, dlrl_Update only advances the timeline and picks a
+ * sheet cell; it never renders or uploads. Frames snap to whole frame numbers. The bake is
+ * rebuilt after theme changes, resizes and budget eviction, and dropped by dlrl_SetAnimation.
+ * Compressed formats fall back to RGBA8 when the GPU lacks DXT support.
+ * @param p Player instance.
+ * @param marker Segment to bake, or DLRL_NO_MARKER for the full timeline.
+ * @param format Sheet encoding.
+ * @return true if the sheets were built.
+ */
+bool dlrl_BakeMarker(dlrl_Player* p, dlrl_MarkerHandle marker, dlrl_BakeFormat format);
+
+/**
+ * @brief Release baked sheets and return to live rendering.
+ * @param p Player instance.
+ */
+void dlrl_ClearBake(dlrl_Player* p);
+
+/**
+ * @brief Query whether the player holds baked sheets.
+ * @param p Player instance.
+ * @param format Optional output for the encoding actually uploaded.
+ * @return true when sheets are resident.
+ */
+bool dlrl_IsBaked(const dlrl_Player* p, dlrl_BakeFormat* format);
+
+/**
+ * @brief Bytes produced by dlrl_CompressImage for an image of the given size.
+ * @param width Image width in pixels.
+ * @param height Image height in pixels.
+ * @param format Target encoding.
+ * @return Output size in bytes.
+ */
+size_t dlrl_CompressedSize(int width, int height, dlrl_BakeFormat format);
+
+/**
+ * @brief Encode RGBA8 pixels with the CPU block encoder used for baking; needs no GPU.
+ *
+ * Partial edge blocks replicate the last row/column.
+ * @param rgba Source pixels, tightly packed.
+ * @param width Image width in pixels.
+ * @param height Image height in pixels.
+ * @param format Target encoding.
+ * @param out Destination of dlrl_CompressedSize bytes.
+ * @return true on success.
+ */
+bool dlrl_CompressImage(const unsigned char* rgba, int width, int height, dlrl_BakeFormat format, unsigned char* out);
+
+/**
+ * @brief Write frames rendered since the last flush to the player's cache file.
+ *
+ * Happens automatically on unload, eviction and animation/theme/size changes. Files are
+ * keyed by asset content hash, animation id, theme id and size; frames are stored
+ * run-length coded, every 16th as a keyframe and the rest as XOR deltas when smaller.
+ * @param p Player instance with frame_cache enabled.
+ * @return true if the file was written (or nothing was pending).
+ */
+bool dlrl_FlushFrameCache(dlrl_Player* p);
+
+/**
+ * @brief Hit/miss counters and file usage of the player's frame cache.
+ * @param p Player instance.
+ * @return Counter snapshot.
+ */
+dlrl_CacheStats dlrl_GetCacheStats(const dlrl_Player* p);
+
+/**
+ * @brief Create a canvas that composites players on the CPU and uploads once per update.
+ * @param width Canvas width in pixels.
+ * @param height Canvas height in pixels.
+ * @return Canvas, or NULL on failure. Call dlrl_UnloadCanvas when done.
+ */
+dlrl_Canvas* dlrl_LoadCanvas(int width, int height);
+
+/**
+ * @brief Destroy a canvas and its texture.
+ * @param c Canvas instance.
+ */
+void dlrl_UnloadCanvas(dlrl_Canvas* c);
+
+/**
+ * @brief Advance every layer's player and composite them back to front.
+ *
+ * Replaces dlrl_Update for these players: their own textures are not refreshed. Only the
+ * bounding box of layers whose frame, placement or tint changed is recomposited and
+ * uploaded, in a single texture update. Placement is axis-aligned with nearest sampling
+ * when scaled. Baked players are skipped; draw them with dlrl_Draw instead.
+ * @param c Canvas instance.
+ * @param layers Layers, back to front.
+ * @param count Number of layers.
+ * @param dt_seconds Delta time in seconds.
+ */
+void dlrl_UpdateCanvas(dlrl_Canvas* c, const dlrl_CanvasLayer* layers, int count, float dt_seconds);
+
+/**
+ * @brief Draw the canvas texture with premultiplied-alpha blending.
+ * @param c Canvas instance.
+ * @param dest Destination rectangle in screen space.
+ * @param tint Tint color applied to the quad.
+ */
+void dlrl_DrawCanvas(const dlrl_Canvas* c, Rectangle dest, Color tint);
+
+/**
+ * @brief Canvas texture holding premultiplied RGBA, for custom drawing.
+ * @param c Canvas instance.
+ * @return Texture handle.
+ */
+Texture2D dlrl_GetCanvasTexture(const dlrl_Canvas* c);
+
+/**
+ * @brief Region uploaded by the last dlrl_UpdateCanvas; empty when nothing changed.
+ * @param c Canvas instance.
+ * @return Dirty rectangle in canvas pixels.
+ */
+Rectangle dlrl_CanvasDirtyRect(const dlrl_Canvas* c);
+
+/**
+ * @brief Render an animation without a window and feed every frame to a sink in order.
+ *
+ * Needs no raylib window or GL context. The output timeline is split into chunks rendered
+ * by separate player instances on worker threads and handed to the sink on the calling
+ * thread in order. Workers stall once max_chunks_in_flight chunks wait for the sink, so
+ * memory stays at that many chunks however long the timeline is.
+ * @param job What to render.
+ * @param sink Frame consumer; sink->end is called even on failure.
+ * @return true if every frame reached the sink.
+ */
+bool dlrl_RenderToSink(const dlrl_RenderJob* job, const dlrl_FrameSink* sink);
+
+/**
+ * @brief Sink that writes Y4M or raw RGBA to a file descriptor (a file, pipe or stdout).
+ *
+ * The sink frees its own state in end(); pass it to dlrl_RenderToSink once. The
+ * descriptor is not closed.
+ * @param fd Open, writable file descriptor.
+ * @param format Stream layout.
+ * @return Sink; frame is NULL on allocation failure.
+ */
+dlrl_FrameSink dlrl_StreamSink(int fd, dlrl_StreamFormat format);
+
+/**
+ * @brief Register a font for text layers, shared by every player.
+ *
+ * Registering the same name with identical bytes again is a no-op, and names with
+ * identical bytes share one copy. The copy is kept until dlrl_Shutdown.
+ * @param name Font family name referenced by the animation's text layers.
+ * @param data Font file bytes (TTF/OTF); copied.
+ * @param size Size of data in bytes.
+ * @return true if the runtime accepted the font.
+ */
+bool dlrl_RegisterFont(const char* name, const void* data, size_t size);
+
+/**
+ * @brief Register a font file, memory-mapped where supported.
+ *
+ * With background set, the file is read and hashed on a loader thread and the call returns
+ * immediately; the next load (dlrl_Load*, dlrl_SetAnimation, dlrl_RenderToSink) waits for
+ * queued fonts. Re-registering the same name and path is a no-op.
+ * @param name Font family name referenced by the animation's text layers.
+ * @param path Font file path.
+ * @param background Load on the loader thread instead of blocking.
+ * @return true if the font was registered, or queued when background is set.
+ */
+bool dlrl_RegisterFontFile(const char* name, const char* path, bool background);
+
+/**
+ * @brief Screen-space corners of a layer's bounds, as placed by the last dlrl_Draw.
+ *
+ * Bounds are queried from the runtime once per rendered frame and cached on the player, then
+ * mapped through the same fit and rotation as dlrl_Draw.
+ * @param p Player instance.
+ * @param layer_name Layer name in the animation.
+ * @param corners Receives four corners in screen space.
+ * @return false if the layer is unknown or the player has not been drawn.
+ */
+bool dlrl_LayerBounds(dlrl_Player* p, const char* layer_name, Vector2 corners[4]);
+
+/**
+ * @brief Make a layer of this player clickable through dlrl_HitTest.
+ *
+ * Within one player, layers are tested in registration order, so register front layers first.
+ * @param p Player instance.
+ * @param layer_name Layer name in the animation.
+ * @return true on success.
+ */
+bool dlrl_AddHitLayer(dlrl_Player* p, const char* layer_name);
+
+/**
+ * @brief Remove every hit layer of a player.
+ * @param p Player instance.
+ */
+void dlrl_ClearHitLayers(dlrl_Player* p);
+
+/**
+ * @brief Find the registered layer under a screen point across all drawn players.
+ *
+ * Players are indexed in a uniform grid by their last dlrl_Draw rectangle; the grid is
+ * rebuilt only after a hit-testable player moves, appears or disappears, so a query touches
+ * one cell. Only players drawn since the query before the latest draws count, so call this
+ * once per frame after drawing; players you stop drawing are no longer hit.
+ * @param point Screen-space point, e.g. GetMousePosition().
+ * @param out Receives the hit; may be NULL.
+ * @return true if a layer was hit.
+ */
+bool dlrl_HitTest(Vector2 point, dlrl_Hit* out);
+
+/**
+ * @brief Live heap and texture counters for leak hunting.
+ *
+ * Only dlrl.c built with DLRL_TRACK_ALLOCS counts (a 16-byte header per block); other
+ * builds return zeros with tracking unset. `make soak` uses this.
+ * @return Counter snapshot.
+ */
+dlrl_AllocStats dlrl_GetAllocStats(void);
+
 #ifdef __cplusplus
 }
 #endif
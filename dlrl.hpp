@@ -0,0 +1,171 @@
+#ifndef __DLRL_HPP__
+#define __DLRL_HPP__
+
+/**
+ * @file dlrl.hpp
+ * @brief Header-only C++20 layer over dlrl.h.
+ *
+ * Every member forwards to the C function of the same name; there are no virtual calls
+ * and no heap allocations beyond what the C API does. Requires C++20 for std::span.
+ */
+
+#include "dlrl.h"
+
+#include <cstddef>
+#include <span>
+#include <string_view>
+#include <utility>
+
+namespace dlrl {
+
+using MarkerHandle = dlrl_MarkerHandle;
+inline constexpr MarkerHandle no_marker = DLRL_NO_MARKER;
+using ThemeHandle = dlrl_ThemeHandle;
+inline constexpr ThemeHandle default_theme = DLRL_DEFAULT_THEME;
+
+/** @brief constexpr builder for dlrl_Config with the same defaults as the README. */
+class Config {
+public:
+    constexpr Config() noexcept = default;
+
+    constexpr Config& size(int width, int height) noexcept { c_.width = width; c_.height = height; return *this; }
+    constexpr Config& speed(float s) noexcept { c_.speed = s; return *this; }
+    constexpr Config& loop(bool l) noexcept { c_.loop = l; return *this; }
+    constexpr Config& mode(dlrl_Mode m) noexcept { c_.mode = m; return *this; }
+    constexpr Config& interpolate(bool i) noexcept { c_.interpolate = i; return *this; }
+    constexpr Config& fit(dlrl_Fit f, Vector2 align = {0.5f, 0.5f}) noexcept { c_.fit = f; c_.align = align; return *this; }
+    constexpr Config& background(Color bg) noexcept { c_.background = bg; return *this; }
+    constexpr Config& animation(const char* id) noexcept { c_.animation_id = id; return *this; }
+    constexpr Config& theme(const char* id) noexcept { c_.theme_id = id; return *this; }
+    constexpr Config& state_machine(const char* id) noexcept { c_.state_machine_id = id; return *this; }
+    constexpr Config& marker(const char* label) noexcept { c_.marker = label; return *this; }
+    constexpr Config& frame_cache(bool on) noexcept { c_.frame_cache = on; return *this; }
+
+    constexpr const dlrl_Config& c() const noexcept { return c_; }
+
+private:
+    dlrl_Config c_ = {
+        0, 0,                       /* width, height */
+        1.0f, true,                 /* speed, loop */
+        DLRL_MODE_FORWARD,
+        true,                       /* interpolate */
+        DLRL_FIT_CONTAIN,
+        {0.5f, 0.5f},               /* align */
+        {0, 0, 0, 0},               /* background */
+        nullptr, nullptr, nullptr, nullptr,
+        false                       /* frame_cache */
+    };
+};
+
+/** @brief Move-only owner of a dlrl_Player; unloads it on destruction. */
+class Player {
+public:
+    constexpr Player() noexcept = default;
+    /** @brief Take ownership of a player created through the C API. */
+    explicit constexpr Player(dlrl_Player* adopt) noexcept : p_(adopt) {}
+    ~Player() { reset(); }
+
+    Player(const Player&) = delete;
+    Player& operator=(const Player&) = delete;
+    constexpr Player(Player&& other) noexcept : p_(std::exchange(other.p_, nullptr)) {}
+    Player& operator=(Player&& other) noexcept {
+        if (this != &other) {
+            reset();
+            p_ = std::exchange(other.p_, nullptr);
+        }
+        return *this;
+    }
+
+    /** @brief Load a .lottie bundle or Lottie JSON file; check the result with operator bool. */
+    static Player load_file(const char* path, const Config& cfg = Config{}) noexcept {
+        return Player(dlrl_LoadDotLottieFile(path, &cfg.c()));
+    }
+    /** @brief Load Lottie JSON from memory (copied). */
+    static Player load_json(std::string_view json, const Config& cfg = Config{}) noexcept {
+        return Player(dlrl_LoadLottieJSON(json.data(), json.size(), &cfg.c()));
+    }
+
+    void reset() noexcept {
+        if (p_) dlrl_Unload(std::exchange(p_, nullptr));
+    }
+    /** @brief Give up ownership without unloading. */
+    [[nodiscard]] dlrl_Player* release() noexcept { return std::exchange(p_, nullptr); }
+    [[nodiscard]] dlrl_Player* get() const noexcept { return p_; }
+    explicit operator bool() const noexcept { return p_ != nullptr; }
+
+    void play() noexcept { dlrl_Play(p_); }
+    void pause() noexcept { dlrl_Pause(p_); }
+    void stop() noexcept { dlrl_Stop(p_); }
+    [[nodiscard]] bool playing() const noexcept { return dlrl_IsPlaying(p_); }
+    void set_speed(float speed) noexcept { dlrl_SetSpeed(p_, speed); }
+    void set_loop(bool loop) noexcept { dlrl_SetLoop(p_, loop); }
+    void set_mode(dlrl_Mode mode) noexcept { dlrl_SetMode(p_, mode); }
+    void set_fixed_step(double step_seconds) noexcept { dlrl_SetFixedStep(p_, step_seconds); }
+
+    void update(float dt_seconds) noexcept { dlrl_Update(p_, dt_seconds); }
+    void draw(Rectangle dest, float rotation = 0.0f, Color tint = {255, 255, 255, 255}) noexcept {
+        dlrl_Draw(p_, dest, rotation, tint);
+    }
+    /** @brief Draw at every dest in one batch; rotations/tints are empty or dests.size() long. */
+    void draw_many(std::span<const Rectangle> dests, std::span<const float> rotations = {},
+                   std::span<const Color> tints = {}) noexcept {
+        dlrl_DrawMany(p_, dests.data(),
+                      rotations.size() == dests.size() ? rotations.data() : nullptr,
+                      tints.size() == dests.size() ? tints.data() : nullptr,
+                      static_cast<int>(dests.size()));
+    }
+
+    [[nodiscard]] MarkerHandle find_marker(std::string_view label) const noexcept {
+        return dlrl_FindMarkerN(p_, label.data(), label.size());
+    }
+    bool set_marker(MarkerHandle marker) noexcept { return dlrl_SetMarkerHandle(p_, marker); }
+    /** @brief Look up and jump without allocating; an empty label plays the whole timeline. */
+    bool set_marker(std::string_view label) noexcept {
+        if (label.empty()) return dlrl_SetMarkerHandle(p_, no_marker);
+        MarkerHandle m = find_marker(label);
+        return m != no_marker && dlrl_SetMarkerHandle(p_, m);
+    }
+    bool set_animation(const char* animation_id) noexcept { return dlrl_SetAnimation(p_, animation_id); }
+    bool set_theme(const char* theme_id) noexcept { return dlrl_SetTheme(p_, theme_id); }
+    bool set_theme_data(const char* theme_json) noexcept { return dlrl_SetThemeData(p_, theme_json); }
+    bool prepare_theme(ThemeHandle theme) noexcept { return dlrl_PrepareTheme(p_, theme); }
+    bool use_theme(ThemeHandle theme) noexcept { return dlrl_UseTheme(p_, theme); }
+    bool resize(int width, int height) noexcept { return dlrl_Resize(p_, width, height); }
+
+    [[nodiscard]] float duration() const noexcept { return dlrl_Duration(p_); }
+    [[nodiscard]] float current_time() const noexcept { return dlrl_CurrentTime(p_); }
+    [[nodiscard]] int total_frames() const noexcept { return dlrl_TotalFrames(p_); }
+    [[nodiscard]] int current_frame() const noexcept { return dlrl_CurrentFrame(p_); }
+    [[nodiscard]] Vector2 natural_size() const noexcept { return dlrl_NaturalSize(p_); }
+    [[nodiscard]] Texture2D texture() const noexcept { return dlrl_GetTexture(p_); }
+    [[nodiscard]] Rectangle source_rect() const noexcept { return dlrl_GetSourceRect(p_); }
+    [[nodiscard]] dlrl_StepInfo last_step() const noexcept { return dlrl_LastStep(p_); }
+
+private:
+    dlrl_Player* p_ = nullptr;
+};
+
+static_assert(sizeof(Player) == sizeof(dlrl_Player*), "dlrl::Player must stay a bare pointer");
+
+/** @brief Advance every player by the same delta. */
+inline void update(std::span<Player> players, float dt_seconds) noexcept {
+    for (Player& p : players) p.update(dt_seconds);
+}
+
+/** @brief Switch every player to the same theme; returns how many switched. */
+inline int use_theme(std::span<Player> players, ThemeHandle theme) noexcept {
+    int switched = 0;
+    for (Player& p : players) switched += p.use_theme(theme) ? 1 : 0;
+    return switched;
+}
+
+/** @brief Draw players[i] into dests[i]; extra elements of the longer span are ignored. */
+inline void draw(std::span<Player> players, std::span<const Rectangle> dests,
+                 Color tint = {255, 255, 255, 255}) noexcept {
+    const std::size_t n = players.size() < dests.size() ? players.size() : dests.size();
+    for (std::size_t i = 0; i < n; ++i) players[i].draw(dests[i], 0.0f, tint);
+}
+
+} // namespace dlrl
+
+#endif
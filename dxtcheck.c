@@ -0,0 +1,241 @@
+/* Checks dlrl_CompressImage, the CPU block encoder behind DXT baking: encodes known images,
+ * decodes them here and compares against the source, then times the encoder. Needs no window. */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "dlrl.h"
+
+#define CHECK_W 30                  /* not a multiple of 4, so edge blocks are covered */
+#define CHECK_H 18
+#define TIMING_SIZE 512
+
+/* Error bounds in 8-bit levels. 565 endpoints alone cost up to 4 levels and a 4-entry palette
+ * on a ramp adds about a sixth of the block's range. Noise has no useful worst case, so it is
+ * held to a mean: a working encoder lands near 48, unrelated colors near 85. */
+#define BOUND_SOLID 4
+#define BOUND_GRADIENT 8
+#define BOUND_ALPHA_RAMP 4
+#define BOUND_NOISE_MEAN 56
+#define NO_BOUND 255
+
+typedef struct {
+    const char* name;
+    dlrl_BakeFormat format;
+    int colorBound;                 /* max RGB error over pixels that stay visible */
+    int meanBound;                  /* mean RGB error over the same pixels */
+    int alphaBound;                 /* DXT5 alpha error; DXT1 alpha must match exactly */
+} DxtCase;
+
+static uint32_t rng_state = 0x9E3779B9u;
+
+static uint32_t next_random(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static void fill(const char* name, unsigned char* px, int w, int h)
+{
+    for (int y = 0; y < h; ++y) {
+        for (int x = 0; x < w; ++x) {
+            unsigned char* c = px + ((size_t)y * (size_t)w + (size_t)x) * 4u;
+            if (strcmp(name, "solid") == 0) {
+                c[0] = 200; c[1] = 90; c[2] = 33; c[3] = 255;
+            } else if (strcmp(name, "gradient") == 0) {
+                /* one ramp along x; a block's colors lie on a line, which BC1 can represent */
+                int t = x * 255 / (w - 1);
+                c[0] = (unsigned char)t;
+                c[1] = (unsigned char)(255 - t);
+                c[2] = (unsigned char)(64 + t / 2);
+                c[3] = 255;
+            } else if (strcmp(name, "noise") == 0) {
+                uint32_t r = next_random();
+                c[0] = (unsigned char)r; c[1] = (unsigned char)(r >> 8); c[2] = (unsigned char)(r >> 16);
+                c[3] = 255;
+            } else if (strcmp(name, "punch-through") == 0) {
+                c[0] = (unsigned char)(x * 255 / (w - 1));
+                c[1] = 128;
+                c[2] = 200;
+                /* checkerboard of 3x3 cells straddles block edges; 127/128 sit on the threshold */
+                c[3] = (((x / 3) + (y / 3)) & 1) ? 255 : 0;
+                if (x == 5 && y == 5) c[3] = 127;
+                if (x == 6 && y == 5) c[3] = 128;
+            } else {
+                c[0] = 40; c[1] = 160; c[2] = 220;
+                c[3] = (unsigned char)(x * 255 / (w - 1));
+            }
+        }
+    }
+}
+
+static void decode565(uint16_t v, int c[3])
+{
+    int r = (v >> 11) & 31, g = (v >> 5) & 63, b = v & 31;
+    c[0] = (r << 3) | (r >> 2);
+    c[1] = (g << 2) | (g >> 4);
+    c[2] = (b << 3) | (b >> 2);
+}
+
+/* Decodes the way the GPU does: BC1 switches to 3 colors plus transparent when c0 <= c1,
+ * while the color half of a BC3 block is always read in 4-color mode. */
+static void decode_color(const unsigned char* in, bool bc1, unsigned char out[16][4])
+{
+    uint16_t c0 = (uint16_t)(in[0] | (in[1] << 8)), c1 = (uint16_t)(in[2] | (in[3] << 8));
+    int pal[4][4];
+    decode565(c0, pal[0]);
+    decode565(c1, pal[1]);
+    pal[0][3] = pal[1][3] = pal[2][3] = pal[3][3] = 255;
+    if (!bc1 || c0 > c1) {
+        for (int ch = 0; ch < 3; ++ch) {
+            pal[2][ch] = (2 * pal[0][ch] + pal[1][ch]) / 3;
+            pal[3][ch] = (pal[0][ch] + 2 * pal[1][ch]) / 3;
+        }
+    } else {
+        for (int ch = 0; ch < 3; ++ch) {
+            pal[2][ch] = (pal[0][ch] + pal[1][ch]) / 2;
+            pal[3][ch] = 0;
+        }
+        pal[3][3] = 0;
+    }
+    uint32_t bits = (uint32_t)in[4] | ((uint32_t)in[5] << 8) | ((uint32_t)in[6] << 16) | ((uint32_t)in[7] << 24);
+    for (int i = 0; i < 16; ++i) {
+        const int* e = pal[(bits >> (2 * i)) & 3u];
+        for (int ch = 0; ch < 4; ++ch) out[i][ch] = (unsigned char)e[ch];
+    }
+}
+
+static void decode_alpha(const unsigned char* in, unsigned char out[16][4])
+{
+    int pal[8] = { in[0], in[1] };
+    if (pal[0] > pal[1]) {
+        for (int i = 2; i < 8; ++i) pal[i] = ((8 - i) * pal[0] + (i - 1) * pal[1]) / 7;
+    } else {
+        for (int i = 2; i < 6; ++i) pal[i] = ((6 - i) * pal[0] + (i - 1) * pal[1]) / 5;
+        pal[6] = 0;
+        pal[7] = 255;
+    }
+    uint64_t bits = 0;
+    for (int i = 0; i < 6; ++i) bits |= (uint64_t)in[2 + i] << (8 * i);
+    for (int i = 0; i < 16; ++i) out[i][3] = (unsigned char)pal[(bits >> (3 * i)) & 7u];
+}
+
+static void decode_image(const unsigned char* in, int w, int h, dlrl_BakeFormat format, unsigned char* px)
+{
+    unsigned char block[16][4];
+    for (int by = 0; by < h; by += 4) {
+        for (int bx = 0; bx < w; bx += 4) {
+            if (format == DLRL_BAKE_DXT5) {
+                decode_color(in + 8, false, block);
+                decode_alpha(in, block);
+                in += 16;
+            } else {
+                decode_color(in, true, block);
+                in += 8;
+            }
+            for (int i = 0; i < 16; ++i) {
+                int x = bx + (i & 3), y = by + (i >> 2);
+                if (x < w && y < h) memcpy(px + ((size_t)y * (size_t)w + (size_t)x) * 4u, block[i], 4);
+            }
+        }
+    }
+}
+
+static bool check_case(const DxtCase* t)
+{
+    size_t pixels = (size_t)CHECK_W * CHECK_H;
+    unsigned char* src = malloc(pixels * 4u);
+    unsigned char* got = malloc(pixels * 4u);
+    unsigned char* packed = malloc(dlrl_CompressedSize(CHECK_W, CHECK_H, t->format));
+    if (!src || !got || !packed) {
+        free(src); free(got); free(packed);
+        fprintf(stderr, "%s: out of memory\n", t->name);
+        return false;
+    }
+    fill(t->name, src, CHECK_W, CHECK_H);
+    bool ok = dlrl_CompressImage(src, CHECK_W, CHECK_H, t->format, packed);
+    if (ok) decode_image(packed, CHECK_W, CHECK_H, t->format, got);
+
+    int colorErr = 0, alphaErr = 0;
+    long colorSum = 0, colorSamples = 0, alphaMismatches = 0;
+    for (size_t i = 0; ok && i < pixels; ++i) {
+        const unsigned char* s = src + i * 4u;
+        const unsigned char* d = got + i * 4u;
+        if (t->format == DLRL_BAKE_DXT1) {
+            /* 1-bit alpha: under half becomes fully transparent, the rest fully opaque */
+            unsigned char want = (s[3] < 128) ? 0 : 255;
+            if (d[3] != want) alphaMismatches++;
+            if (want == 0) continue;
+        } else {
+            int e = abs(s[3] - d[3]);
+            if (e > alphaErr) alphaErr = e;
+        }
+        for (int ch = 0; ch < 3; ++ch) {
+            int e = abs(s[ch] - d[ch]);
+            if (e > colorErr) colorErr = e;
+            colorSum += e;
+            colorSamples++;
+        }
+    }
+    double colorMean = colorSamples > 0 ? (double)colorSum / (double)colorSamples : 0.0;
+    bool pass = ok && colorErr <= t->colorBound && colorMean <= t->meanBound &&
+                alphaErr <= t->alphaBound && alphaMismatches == 0;
+    printf("  %s %-14s color max %3d (bound %3d) mean %5.1f (bound %3d)  ",
+           t->format == DLRL_BAKE_DXT1 ? "dxt1" : "dxt5", t->name, colorErr, t->colorBound,
+           colorMean, t->meanBound);
+    if (t->format == DLRL_BAKE_DXT1) printf("1-bit alpha mismatches %ld", alphaMismatches);
+    else printf("alpha max %3d (bound %3d)", alphaErr, t->alphaBound);
+    printf("  %s\n", pass ? "ok" : "FAIL");
+    free(src); free(got); free(packed);
+    return pass;
+}
+
+static void time_format(const unsigned char* src, unsigned char* packed, dlrl_BakeFormat format, int rounds)
+{
+    clock_t t0 = clock();
+    for (int r = 0; r < rounds; ++r) dlrl_CompressImage(src, TIMING_SIZE, TIMING_SIZE, format, packed);
+    double seconds = (double)(clock() - t0) / CLOCKS_PER_SEC;
+    double mpix = (double)TIMING_SIZE * TIMING_SIZE * rounds / 1e6;
+    printf("  %s %dx%d x%d: %.1f MPix/s\n", format == DLRL_BAKE_DXT1 ? "dxt1" : "dxt5",
+           TIMING_SIZE, TIMING_SIZE, rounds, seconds > 0.0 ? mpix / seconds : 0.0);
+}
+
+int main(int argc, char** argv)
+{
+    int rounds = (argc > 1) ? atoi(argv[1]) : 20;
+    if (rounds < 1) rounds = 1;
+
+    static const DxtCase cases[] = {
+        { "solid",         DLRL_BAKE_DXT1, BOUND_SOLID,    BOUND_SOLID,      0 },
+        { "gradient",      DLRL_BAKE_DXT1, BOUND_GRADIENT, BOUND_GRADIENT,   0 },
+        { "noise",         DLRL_BAKE_DXT1, NO_BOUND,       BOUND_NOISE_MEAN, 0 },
+        { "punch-through", DLRL_BAKE_DXT1, BOUND_GRADIENT, BOUND_GRADIENT,   0 },
+        { "solid",         DLRL_BAKE_DXT5, BOUND_SOLID,    BOUND_SOLID,      0 },
+        { "gradient",      DLRL_BAKE_DXT5, BOUND_GRADIENT, BOUND_GRADIENT,   0 },
+        { "noise",         DLRL_BAKE_DXT5, NO_BOUND,       BOUND_NOISE_MEAN, 0 },
+        { "alpha-ramp",    DLRL_BAKE_DXT5, BOUND_SOLID,    BOUND_SOLID,      BOUND_ALPHA_RAMP },
+    };
+    printf("block encoder, %dx%d images\n", CHECK_W, CHECK_H);
+    int failures = 0;
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); ++i) {
+        if (!check_case(&cases[i])) failures++;
+    }
+
+    unsigned char* src = malloc((size_t)TIMING_SIZE * TIMING_SIZE * 4u);
+    unsigned char* packed = malloc(dlrl_CompressedSize(TIMING_SIZE, TIMING_SIZE, DLRL_BAKE_DXT5));
+    if (src && packed) {
+        fill("gradient", src, TIMING_SIZE, TIMING_SIZE);
+        printf("encode speed (gradient)\n");
+        time_format(src, packed, DLRL_BAKE_DXT1, rounds);
+        time_format(src, packed, DLRL_BAKE_DXT5, rounds);
+    }
+    free(src);
+    free(packed);
+
+    printf("%s\n", failures == 0 ? "PASS" : "FAIL");
+    return failures == 0 ? 0 : 1;
+}
@@ -1,6 +1,4 @@
-#include <ctype.h>
 #include <stdbool.h>
-#include <string.h>
 
 #include "raylib.h"
 #include "dlrl.h"
@@ -9,7 +7,7 @@ typedef struct {
     int key;
     const char* markerName;
     float moveDir;
-    bool available;
+    dlrl_MarkerHandle marker;
 } MarkerBinding;
 
 static float clampf(float v, float lo, float hi) {
@@ -18,30 +16,6 @@ static float clampf(float v, float lo, float hi) {
     return v;
 }
 
-static bool equals_ignore_case(const char* a, const char* b) {
-    if (!a || !b) return false;
-    while (*a && *b) {
-        if (tolower((unsigned char)*a) != tolower((unsigned char)*b)) {
-            return false;
-        }
-        ++a;
-        ++b;
-    }
-    return *a == 0 && *b == 0;
-}
-
-static bool marker_exists(dlrl_Player* player, const char* name) {
-    if (!player || !name) return false;
-    int count = dlrl_MarkerCount(player);
-    for (int i = 0; i < count; ++i) {
-        const char* candidate = dlrl_MarkerName(player, i);
-        if (candidate && equals_ignore_case(candidate, name)) {
-            return true;
-        }
-    }
-    return false;
-}
-
 int main(int argc, char** argv) {
     const char* asset_path = (argc > 1 && argv[1]) ? argv[1] : "super-man.lottie";
     InitWindow(960, 540, "dotLottie Raylib");
@@ -69,23 +43,26 @@ int main(int argc, char** argv) {
     dlrl_Play(p);
 
     MarkerBinding bindings[] = {
-        { KEY_J, "Punch", 0.f, false },
-        { KEY_K, "Lazer", 0.f, false },
-        { KEY_W, "UpperCut", 0.f, false },
-        { KEY_D, "Right", 1.f, false },
-        { KEY_A, "Left", -1.f, false },
+        { KEY_J, "Punch", 0.f, DLRL_NO_MARKER },
+        { KEY_K, "Lazer", 0.f, DLRL_NO_MARKER },
+        { KEY_W, "UpperCut", 0.f, DLRL_NO_MARKER },
+        { KEY_D, "Right", 1.f, DLRL_NO_MARKER },
+        { KEY_A, "Left", -1.f, DLRL_NO_MARKER },
     };
     const int bindingCount = (int)(sizeof(bindings) / sizeof(bindings[0]));
     for (int i = 0; i < bindingCount; ++i) {
-        bindings[i].available = marker_exists(p, bindings[i].markerName);
+        bindings[i].marker = dlrl_FindMarker(p, bindings[i].markerName);
+        if (bindings[i].marker != DLRL_NO_MARKER && bindings[i].moveDir == 0.f) {
+            dlrl_WarmMarker(p, bindings[i].markerName);
+        }
     }
 
-    const char* idleMarker = marker_exists(p, "Idle") ? "Idle" : NULL;
-    const char* idleLabel = idleMarker ? idleMarker : "Full Timeline";
-    const char* currentMarker = idleMarker;
+    const dlrl_MarkerHandle idleMarker = dlrl_FindMarker(p, "Idle");
+    const char* idleLabel = (idleMarker != DLRL_NO_MARKER) ? "Idle" : "Full Timeline";
+    dlrl_MarkerHandle currentMarker = idleMarker;
     const char* currentLabel = idleLabel;
-    if (idleMarker) dlrl_SetMarker(p, idleMarker);
-    else dlrl_SetMarker(p, NULL);
+    dlrl_SetMarkerHandle(p, idleMarker);
+    if (idleMarker != DLRL_NO_MARKER) dlrl_WarmMarker(p, "Idle");
 
     Vector2 heroCenter = { GetScreenWidth() * 0.5f, GetScreenHeight() * 0.5f };
     const Vector2 animSize = { 260, 200 };
@@ -101,7 +78,7 @@ int main(int argc, char** argv) {
         float moveIntent = 0.f;
         for (int i = 0; i < bindingCount; ++i) {
             MarkerBinding* binding = &bindings[i];
-            if (!binding->available) continue;
+            if (binding->marker == DLRL_NO_MARKER) continue;
             if (binding->moveDir != 0.f && IsKeyDown(binding->key)) {
                 moveIntent += binding->moveDir;
             }
@@ -111,10 +88,10 @@ int main(int argc, char** argv) {
         }
         heroCenter.x = clampf(heroCenter.x + moveIntent * heroSpeed * dt, minX, maxX);
 
-        const char* desiredMarker = engagedBinding ? engagedBinding->markerName : idleMarker;
+        dlrl_MarkerHandle desiredMarker = engagedBinding ? engagedBinding->marker : idleMarker;
         const char* desiredLabel = engagedBinding ? engagedBinding->markerName : idleLabel;
         if (desiredMarker != currentMarker) {
-            if (dlrl_SetMarker(p, desiredMarker)) {
+            if (dlrl_SetMarkerHandle(p, desiredMarker)) {
                 currentMarker = desiredMarker;
                 currentLabel = desiredLabel;
             }
@@ -137,7 +114,7 @@ int main(int argc, char** argv) {
 
         DrawText("Controls: A=Left  D=Right  W=UpperCut  J=Punch  K=Lazer", 20, 20, 18, DARKGRAY);
         DrawText(TextFormat("State: %s", currentLabel), 20, 46, 24, MAROON);
-        if (!idleMarker) {
+        if (idleMarker == DLRL_NO_MARKER) {
             DrawText("No idle marker in this asset; releasing keys replays the full clip.", 20, 78, 16, DARKGRAY);
         }
         EndDrawing();
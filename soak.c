@@ -0,0 +1,142 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "raylib.h"
+#include "dlrl.h"
+
+#define MAX_ANIMATIONS 16
+
+static void usage(const char* argv0) {
+    fprintf(stderr,
+        "usage: %s [asset] [options]\n"
+        "  -n <cycles>      load/switch/unload cycles (default 2000)\n"
+        "  -a <id,id,...>   animation ids to switch between with dlrl_SetAnimation\n"
+        "  -t <bytes>       allowed heap drift after warm-up (default 65536)\n",
+        argv0);
+}
+
+static double ms(double seconds) { return seconds * 1000.0; }
+
+int main(int argc, char** argv) {
+    const char* asset = "super-man.lottie";
+    int cycles = 2000;
+    size_t tolerance = 64u << 10;
+    char idBuf[512] = {0};
+    const char* ids[MAX_ANIMATIONS];
+    int idCount = 0;
+
+    int argi = 1;
+    if (argi < argc && argv[argi][0] != '-') asset = argv[argi++];
+    for (; argi < argc; argi += 2) {
+        const char* opt = argv[argi];
+        const char* val = (argi + 1 < argc) ? argv[argi + 1] : NULL;
+        if (!val) { usage(argv[0]); return 2; }
+        if (strcmp(opt, "-n") == 0) cycles = atoi(val);
+        else if (strcmp(opt, "-t") == 0) tolerance = (size_t)strtoull(val, NULL, 10);
+        else if (strcmp(opt, "-a") == 0) {
+            strncpy(idBuf, val, sizeof(idBuf) - 1);
+            for (char* tok = strtok(idBuf, ","); tok && idCount < MAX_ANIMATIONS; tok = strtok(NULL, ",")) {
+                ids[idCount++] = tok;
+            }
+        } else { usage(argv[0]); return 2; }
+    }
+    if (cycles < 10) cycles = 10;
+
+    if (!dlrl_GetAllocStats().tracking) {
+        fprintf(stderr, "soak: dlrl.c was built without DLRL_TRACK_ALLOCS\n");
+        return 2;
+    }
+
+    /* Players own GPU textures, so even a soak run needs a GL context; use xvfb-run on CI. */
+    SetTraceLogLevel(LOG_WARNING);
+    SetConfigFlags(FLAG_WINDOW_HIDDEN);
+    InitWindow(64, 64, "dlrl soak");
+    dlrl_Init();
+
+    dlrl_Config cfg = {
+        .speed = 1.0f, .loop = true,
+        .mode = DLRL_MODE_FORWARD,
+        .interpolate = true,
+        .fit = DLRL_FIT_CONTAIN,
+        .align = {0.5f, 0.5f},
+        .background = BLANK
+    };
+
+    /* The first cycles fill the texture pool and other bounded caches; measure after them. */
+    const int warmup = cycles / 10;
+    dlrl_AllocStats baseline = {0};
+    size_t worstDrift = 0;
+    int worstTextures = 0;
+    double loadTime = 0.0, switchTime = 0.0, unloadTime = 0.0;
+    int switches = 0;
+    double start = GetTime();
+
+    for (int i = 0; i < cycles; ++i) {
+        double t0 = GetTime();
+        dlrl_Player* p = dlrl_LoadDotLottieFile(asset, &cfg);
+        double t1 = GetTime();
+        if (!p) {
+            fprintf(stderr, "soak: failed to load %s on cycle %d\n", asset, i);
+            CloseWindow();
+            return 1;
+        }
+        loadTime += t1 - t0;
+        dlrl_Play(p);
+        dlrl_Update(p, 1.0f / 60.0f);
+
+        t0 = GetTime();
+        int markers = dlrl_MarkerCount(p);
+        if (markers > 0) {
+            dlrl_SetMarker(p, dlrl_MarkerName(p, i % markers));
+            dlrl_Update(p, 1.0f / 60.0f);
+            ++switches;
+        }
+        if (idCount > 0) {
+            dlrl_SetAnimation(p, ids[i % idCount]);
+            dlrl_Update(p, 1.0f / 60.0f);
+            ++switches;
+        }
+        dlrl_SetMarker(p, NULL);
+        dlrl_Update(p, 0.5f);
+        t1 = GetTime();
+        switchTime += t1 - t0;
+
+        t0 = GetTime();
+        dlrl_Unload(p);
+        unloadTime += GetTime() - t0;
+
+        dlrl_AllocStats now = dlrl_GetAllocStats();
+        if (i + 1 == warmup) baseline = now;
+        if (i + 1 > warmup) {
+            size_t drift = (now.live_bytes > baseline.live_bytes) ? now.live_bytes - baseline.live_bytes : 0;
+            if (drift > worstDrift) worstDrift = drift;
+            if (now.live_textures - baseline.live_textures > worstTextures) {
+                worstTextures = now.live_textures - baseline.live_textures;
+            }
+        }
+        if ((i + 1) % (cycles / 10) == 0) {
+            fprintf(stderr, "cycle %5d  live %8zu B  peak %8zu B  textures %d\n",
+                    i + 1, now.live_bytes, now.peak_bytes, now.live_textures);
+        }
+    }
+    double elapsed = GetTime() - start;
+
+    dlrl_Shutdown();
+    dlrl_AllocStats final = dlrl_GetAllocStats();
+    CloseWindow();
+
+    printf("cycles        %d in %.2fs (%.1f cycles/s)\n", cycles, elapsed, cycles / elapsed);
+    printf("load          %.3f ms avg\n", ms(loadTime / cycles));
+    printf("switch        %.3f ms avg over %d switches\n", switches ? ms(switchTime / switches) : 0.0, switches);
+    printf("unload        %.3f ms avg\n", ms(unloadTime / cycles));
+    printf("peak heap     %zu B\n", final.peak_bytes);
+    printf("drift         %zu B heap, %d textures after warm-up\n", worstDrift, worstTextures);
+    printf("after close   %zu B in %zu blocks, %d textures\n",
+           final.live_bytes, final.live_allocations, final.live_textures);
+
+    bool ok = worstDrift <= tolerance && worstTextures <= 0 &&
+              final.live_bytes == 0 && final.live_allocations == 0 && final.live_textures == 0;
+    printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}